@@ -1,6 +1,12 @@
 // Generated File - DO NOT EDIT
+// Define MAPS_EXCLUDE_<name> in the build flags to leave a map out of the build.
 #pragma once
 
+#include "world/ChunkedMapData.hpp"
+#include "world/EventLayerData.hpp"
+#include "world/TriggerIndexData.hpp"
+#include "world/MapTable.hpp"
+
 enum MapEnum {
     EMPTY = 0,
     Collide,
@@ -8,469 +14,17 @@ enum MapEnum {
 	GoToTitle
 };
 
-inline const uint8_t gardenPath[] = {
-14, 11,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
-0x02, 0x03, 0x03, 0x03, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
-0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x01, 0x01, 0x01, 0x01, 0x06, 0x07, 0x01, 0x00,
-0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x01, 0x01, 0x01, 0x08, 0x09, 0x01, 0x00,
-0x0a, 0x0b, 0x0b, 0x0b, 0x0c, 0x04, 0x04, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
-0x00, 0x01, 0x01, 0x01, 0x01, 0x0c, 0x04, 0x04, 0x05, 0x01, 0x01, 0x01, 0x01, 0x00,
-0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0c, 0x04, 0x04, 0x05, 0x01, 0x01, 0x01, 0x00,
-0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0c, 0x04, 0x04, 0x05, 0x01, 0x0d, 0x0e,
-0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0c, 0x04, 0x04, 0x05, 0x0f, 0x10,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x04, 0x04, 0x04, 0x04
-};
-inline MapEnum gardenPathEnum(uint32_t x, uint32_t y){
-static const MapEnum parameters[] = {
-	Collide,
-	Collide,
-	Collide,
-	Collide,
-	Collide,
-	Collide,
-	Collide,
-	Collide,
-	Collide,
-	Collide,
-	Collide,
-	Collide,
-	Collide,
-	Collide,
-	Collide,
-	GoToEncounter,
-	GoToEncounter,
-	GoToEncounter,
-	GoToEncounter,
-	GoToEncounter,
-	GoToEncounter,
-	GoToEncounter,
-	GoToEncounter,
-	GoToEncounter,
-	GoToEncounter,
-	GoToEncounter,
-	GoToEncounter,
-	Collide,
-	Collide,
-	EMPTY,
-	EMPTY,
-	EMPTY,
-	EMPTY,
-	GoToEncounter,
-	GoToEncounter,
-	GoToEncounter,
-	GoToEncounter,
-	GoToEncounter,
-	GoToEncounter,
-	GoToEncounter,
-	GoToEncounter,
-	Collide,
-	GoToTitle,
-	EMPTY,
-	EMPTY,
-	EMPTY,
-	EMPTY,
-	EMPTY,
-	GoToEncounter,
-	GoToEncounter,
-	GoToEncounter,
-	GoToEncounter,
-	Collide,
-	Collide,
-	GoToEncounter,
-	Collide,
-	GoToTitle,
-	EMPTY,
-	EMPTY,
-	EMPTY,
-	EMPTY,
-	EMPTY,
-	EMPTY,
-	GoToEncounter,
-	GoToEncounter,
-	GoToEncounter,
-	Collide,
-	Collide,
-	GoToEncounter,
-	Collide,
-	Collide,
-	EMPTY,
-	EMPTY,
-	EMPTY,
-	EMPTY,
-	EMPTY,
-	EMPTY,
-	EMPTY,
-	GoToEncounter,
-	GoToEncounter,
-	GoToEncounter,
-	GoToEncounter,
-	GoToEncounter,
-	Collide,
-	Collide,
-	GoToEncounter,
-	GoToEncounter,
-	GoToEncounter,
-	GoToEncounter,
-	EMPTY,
-	EMPTY,
-	EMPTY,
-	EMPTY,
-	GoToEncounter,
-	GoToEncounter,
-	GoToEncounter,
-	GoToEncounter,
-	Collide,
-	Collide,
-	GoToEncounter,
-	GoToEncounter,
-	GoToEncounter,
-	GoToEncounter,
-	GoToEncounter,
-	EMPTY,
-	EMPTY,
-	EMPTY,
-	EMPTY,
-	GoToEncounter,
-	GoToEncounter,
-	GoToEncounter,
-	Collide,
-	Collide,
-	GoToEncounter,
-	GoToEncounter,
-	GoToEncounter,
-	GoToEncounter,
-	GoToEncounter,
-	GoToEncounter,
-	EMPTY,
-	EMPTY,
-	EMPTY,
-	EMPTY,
-	GoToEncounter,
-	GoToEncounter,
-	Collide,
-	Collide,
-	GoToEncounter,
-	GoToEncounter,
-	GoToEncounter,
-	GoToEncounter,
-	GoToEncounter,
-	GoToEncounter,
-	GoToEncounter,
-	EMPTY,
-	EMPTY,
-	EMPTY,
-	EMPTY,
-	Collide,
-	Collide,
-	Collide,
-	Collide,
-	Collide,
-	Collide,
-	Collide,
-	Collide,
-	Collide,
-	Collide,
-	Collide,
-	GoToTitle,
-	GoToTitle,
-	GoToTitle,
-	GoToTitle,
-	GoToTitle
-    };
-    return (x >= 14 || y >= 11) ? EMPTY : parameters[y * 14 + x];
-}
-
-
-inline const uint8_t tiles[] = {
-0x6b,0x6c,0x6b,0x6a,0x72,0x72,0x72,0x72,0x72,0x72,0x6b,0x6c,0x6c,0x6b,0x6c,0x6b,
-0x6d,0x6c,0x72,0x72,0x72,0x72,0x6c,0x72,0x6c,0x72,0x72,0x72,0x6b,0x6b,0x6b,0x6a,
-0x6c,0x72,0x72,0x72,0x6c,0x6c,0x6c,0x6c,0x6c,0x6c,0x72,0x72,0x72,0x6a,0x6b,0x1b,
-0x6a,0x51,0x51,0x72,0x72,0x6c,0x6c,0x6c,0x6c,0x72,0x72,0x72,0x51,0x6d,0x6b,0x6b,
-0x51,0x51,0x72,0x72,0x6c,0x72,0x6c,0x6c,0x72,0x6c,0x72,0x72,0x72,0x51,0x6b,0x6d,
-0x51,0x72,0x51,0x72,0x72,0x72,0x6c,0x72,0x72,0x72,0x72,0x51,0x51,0x51,0x6a,0x6c,
-0x51,0x51,0x72,0x72,0x51,0x72,0x72,0x72,0x72,0x51,0x72,0x72,0x51,0x51,0x6c,0x6a,
-0x72,0x51,0x51,0x51,0x72,0x72,0x51,0x72,0x72,0x72,0x51,0x72,0x51,0x72,0x6c,0x6b,
-0x51,0x72,0x72,0x51,0x72,0x51,0x51,0x72,0x51,0x51,0x51,0x51,0x51,0x51,0x6b,0x19,
-0x6a,0x51,0x51,0x51,0x51,0x72,0x51,0x51,0x51,0x72,0x51,0x72,0x51,0x6c,0x6c,0x6a,
-0x6b,0x6c,0x51,0x51,0x51,0x72,0x51,0x51,0x51,0x51,0x72,0x51,0x6b,0x6b,0x6b,0x6b,
-0x6b,0x6c,0x03,0x03,0x03,0x51,0x51,0x63,0x51,0x03,0x03,0x03,0x03,0x6c,0x6d,0x6c,
-0x6c,0x03,0x03,0x03,0x03,0x51,0x63,0x63,0x51,0x03,0x03,0x03,0x03,0x03,0x6c,0x6b,
-0x6b,0x03,0x03,0x03,0x51,0x63,0x63,0x63,0x51,0x51,0x03,0x03,0x03,0x03,0x6c,0x6c,
-0x6a,0x6c,0x03,0x03,0x03,0x63,0x51,0x63,0x63,0x03,0x03,0x03,0x03,0x19,0x6b,0x6a,
-0x6a,0x6b,0x6b,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x6d,0x6c,0x6b,0x1b,0x6a,
-
-0x6b,0x6c,0x6b,0x6a,0x6b,0x6b,0x6d,0x6b,0x6b,0x6b,0x6b,0x6c,0x6c,0x6b,0x6c,0x6b,
-0x6d,0x6c,0x6b,0x6b,0x6b,0x6b,0x6c,0x6b,0x6d,0x6b,0x6b,0x6a,0x6b,0x6b,0x6b,0x6a,
-0x6c,0x6b,0x6c,0x6b,0x6c,0x6b,0x6c,0x6d,0x6c,0x1a,0x6b,0x6d,0x6a,0x6a,0x6b,0x1b,
-0x6a,0x6b,0x6b,0x6a,0x6b,0x6c,0x6b,0x6c,0x1b,0x6d,0x6b,0x6d,0x6b,0x6d,0x6b,0x6b,
-0x6b,0x6d,0x6d,0x6d,0x6b,0x6c,0x6b,0x6b,0x6b,0x6c,0x6d,0x6c,0x6d,0x6c,0x6b,0x6d,
-0x6c,0x6c,0x6c,0x6c,0x6c,0x6b,0x6a,0x6a,0x6b,0x6c,0x6c,0x6c,0x6b,0x6b,0x6a,0x6c,
-0x6b,0x6b,0x6c,0x6c,0x6b,0x6d,0x6a,0x6b,0x6d,0x6b,0x6b,0x6c,0x6b,0x6d,0x6c,0x6a,
-0x6b,0x6b,0x6a,0x6b,0x6b,0x6c,0x6b,0x6b,0x6b,0x1a,0x6b,0x6c,0x6b,0x6b,0x6c,0x6b,
-0x6a,0x6b,0x6a,0x6a,0x6a,0x6c,0x6c,0x6b,0x6b,0x6a,0x6a,0x6a,0x6c,0x6c,0x6b,0x19,
-0x6a,0x6d,0x6b,0x6b,0x6b,0x6a,0x6a,0x6a,0x6d,0x6b,0x6c,0x6b,0x6b,0x6c,0x6c,0x6a,
-0x6b,0x6c,0x6b,0x6a,0x6b,0x6b,0x6c,0x6b,0x6b,0x6a,0x6b,0x6d,0x6b,0x6b,0x6b,0x6b,
-0x6b,0x6c,0x1b,0x6b,0x6c,0x6d,0x6c,0x6b,0x6d,0x6b,0x6c,0x6c,0x6b,0x6c,0x6d,0x6c,
-0x6c,0x1a,0x6c,0x6d,0x6b,0x6b,0x6c,0x6b,0x6c,0x6b,0x6d,0x6b,0x6c,0x6b,0x6c,0x6b,
-0x6b,0x6c,0x6b,0x6d,0x1b,0x6c,0x6b,0x6a,0x6b,0x6a,0x6b,0x6b,0x6b,0x6b,0x6c,0x6c,
-0x6a,0x6c,0x6b,0x6c,0x6d,0x6c,0x6d,0x6b,0x6d,0x6b,0x6c,0x6a,0x6d,0x19,0x6b,0x6a,
-0x6a,0x6b,0x6b,0x6b,0x6c,0x1a,0x6b,0x1a,0x6c,0x6b,0x6c,0x6d,0x6c,0x6b,0x1b,0x6a,
-
-0x6d,0x6c,0x6b,0x6b,0x72,0x72,0x72,0x72,0x72,0x72,0x6b,0x6c,0x6c,0x6b,0x6c,0x6a,
-0x6d,0x6b,0x72,0x72,0x72,0x72,0x6c,0x72,0x6c,0x72,0x72,0x72,0x6b,0x6b,0x6b,0x6b,
-0x6b,0x72,0x72,0x72,0x6c,0x6c,0x6c,0x6c,0x6c,0x6c,0x72,0x72,0x72,0x6c,0x6b,0x6c,
-0x6b,0x51,0x51,0x72,0x72,0x6c,0x6c,0x6c,0x6c,0x72,0x72,0x72,0x51,0x6c,0x6b,0x6b,
-0x51,0x51,0x72,0x72,0x6c,0x72,0x6c,0x6c,0x72,0x6c,0x72,0x72,0x72,0x51,0x6b,0x6d,
-0x51,0x72,0x51,0x72,0x72,0x72,0x6c,0x72,0x72,0x72,0x72,0x51,0x51,0x51,0x6b,0x6b,
-0x51,0x51,0x72,0x72,0x51,0x72,0x72,0x72,0x72,0x51,0x72,0x72,0x51,0x51,0x6d,0x6a,
-0x72,0x51,0x51,0x51,0x72,0x72,0x51,0x72,0x72,0x72,0x51,0x72,0x51,0x72,0x6b,0x6a,
-0x51,0x72,0x72,0x51,0x72,0x51,0x51,0x72,0x51,0x51,0x51,0x51,0x51,0x51,0x6b,0x19,
-0x6a,0x51,0x51,0x51,0x51,0x72,0x51,0x51,0x51,0x72,0x51,0x72,0x51,0x6c,0x6b,0x6b,
-0x6b,0x6c,0x51,0x51,0x51,0x72,0x51,0x51,0x51,0x51,0x72,0x51,0x6b,0x6b,0x6d,0x6c,
-0x6b,0x6b,0x03,0x03,0x03,0x51,0x51,0x63,0x51,0x03,0x03,0x03,0x03,0x6c,0x6c,0x6b,
-0x6b,0x03,0x03,0x03,0x03,0x51,0x63,0x63,0x51,0x03,0x03,0x03,0x03,0x03,0x6d,0x6b,
-0x6b,0x03,0x03,0x03,0x51,0x63,0x63,0x63,0x51,0x51,0x03,0x03,0x03,0x03,0x6c,0x6b,
-0x19,0x6c,0x03,0x03,0x03,0x63,0x51,0x63,0x63,0x03,0x03,0x03,0x03,0x05,0x05,0x6a,
-0x04,0x04,0x04,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x05,0x04,0x04,0x04,0x04,
-
-0x6d,0x6c,0x6b,0x6b,0x6c,0x6b,0x6d,0x6b,0x6d,0x6b,0x6b,0x6c,0x6c,0x6b,0x6c,0x6a,
-0x6d,0x6b,0x6c,0x6b,0x6b,0x6b,0x6c,0x6d,0x6c,0x6a,0x6b,0x6b,0x6b,0x6b,0x6b,0x6b,
-0x6b,0x6b,0x6b,0x6b,0x6c,0x6d,0x6c,0x6c,0x6b,0x6a,0x6b,0x6d,0x6b,0x6c,0x6b,0x6c,
-0x6b,0x6c,0x6b,0x6b,0x6b,0x6c,0x6b,0x6b,0x6c,0x6d,0x6c,0x6c,0x6d,0x6c,0x6b,0x6b,
-0x6d,0x6d,0x6d,0x6d,0x6b,0x6b,0x6a,0x6b,0x6a,0x6b,0x6c,0x6c,0x6c,0x6b,0x6b,0x6d,
-0x6b,0x6c,0x6d,0x6b,0x6b,0x6b,0x6a,0x6b,0x6d,0x6c,0x6b,0x6b,0x6b,0x6d,0x6b,0x6b,
-0x6b,0x6b,0x6b,0x6b,0x6b,0x6d,0x6a,0x6b,0x6b,0x6a,0x6b,0x6c,0x6b,0x6c,0x6d,0x6a,
-0x6b,0x6b,0x6a,0x6b,0x6b,0x6c,0x6b,0x6a,0x6a,0x19,0x6b,0x6a,0x6b,0x6b,0x6b,0x6a,
-0x6a,0x6b,0x6b,0x6a,0x6b,0x6a,0x19,0x6a,0x6d,0x6a,0x6a,0x6a,0x6b,0x6d,0x6b,0x19,
-0x6a,0x6d,0x6b,0x6b,0x6c,0x6b,0x6c,0x6b,0x6c,0x6b,0x6b,0x6c,0x6b,0x6c,0x6b,0x6b,
-0x6b,0x6c,0x6b,0x6b,0x6d,0x6b,0x6c,0x6b,0x6a,0x6a,0x6b,0x6d,0x6b,0x6b,0x6d,0x6c,
-0x6b,0x6b,0x6c,0x6b,0x6c,0x1b,0x6c,0x6b,0x6d,0x6b,0x6d,0x6c,0x6c,0x6c,0x6c,0x6b,
-0x6b,0x6a,0x6c,0x6b,0x6b,0x6b,0x6b,0x6b,0x6b,0x6a,0x6c,0x6b,0x6b,0x6b,0x6d,0x6b,
-0x6b,0x6d,0x6c,0x6c,0x6d,0x6b,0x6d,0x6b,0x6c,0x6a,0x6b,0x6b,0x6c,0x6b,0x6c,0x6b,
-0x19,0x6c,0x05,0x06,0x6c,0x1b,0x05,0x06,0x05,0x04,0x6c,0x6b,0x6d,0x05,0x05,0x6a,
-0x04,0x04,0x04,0x04,0x04,0x04,0x05,0x05,0x06,0x06,0x06,0x05,0x04,0x04,0x04,0x04,
-
-0x06,0x06,0x06,0x05,0x05,0x05,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x05,0x06,0x06,
-0x06,0x06,0x04,0x04,0x04,0x05,0x05,0x05,0x05,0x06,0x06,0x06,0x06,0x05,0x04,0x05,
-0x05,0x05,0x05,0x05,0x06,0x05,0x05,0x05,0x06,0x06,0x06,0x06,0x06,0x05,0x06,0x06,
-0x05,0x06,0x06,0x06,0x06,0x06,0x05,0x06,0x06,0x06,0x06,0x06,0x05,0x05,0x06,0x06,
-0x05,0x04,0x04,0x04,0x04,0x04,0x05,0x04,0x06,0x06,0x06,0x06,0x06,0x04,0x05,0x05,
-0x05,0x05,0x06,0x05,0x06,0x06,0x05,0x04,0x06,0x06,0x06,0x05,0x05,0x06,0x05,0x05,
-0x06,0x06,0x06,0x06,0x06,0x06,0x05,0x05,0x05,0x06,0x06,0x06,0x05,0x05,0x06,0x06,
-0x05,0x04,0x04,0x04,0x04,0x06,0x06,0x06,0x05,0x05,0x05,0x05,0x06,0x05,0x05,0x05,
-0x05,0x05,0x06,0x05,0x05,0x06,0x06,0x06,0x06,0x05,0x06,0x05,0x05,0x06,0x06,0x05,
-0x06,0x06,0x05,0x06,0x04,0x04,0x04,0x04,0x04,0x04,0x05,0x06,0x06,0x06,0x04,0x06,
-0x06,0x06,0x06,0x06,0x06,0x06,0x04,0x05,0x05,0x05,0x05,0x06,0x06,0x04,0x04,0x06,
-0x06,0x05,0x05,0x05,0x05,0x04,0x04,0x05,0x06,0x06,0x06,0x06,0x06,0x05,0x04,0x04,
-0x05,0x06,0x05,0x06,0x06,0x05,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x06,0x06,
-0x06,0x06,0x06,0x05,0x06,0x05,0x05,0x05,0x05,0x05,0x06,0x06,0x06,0x05,0x05,0x04,
-0x05,0x05,0x05,0x06,0x06,0x04,0x05,0x04,0x05,0x06,0x06,0x06,0x06,0x04,0x04,0x06,
-0x06,0x06,0x06,0x06,0x04,0x04,0x05,0x05,0x06,0x06,0x06,0x06,0x05,0x05,0x06,0x06,
-
-0x04,0x6b,0x6a,0x6b,0x6d,0x6b,0x6c,0x6b,0x6d,0x6a,0x6c,0x6b,0x6b,0x6c,0x6b,0x6a,
-0x05,0x05,0x05,0x05,0x04,0x6b,0x6c,0x6d,0x6b,0x19,0x6b,0x6b,0x6a,0x6b,0x6b,0x6d,
-0x05,0x05,0x05,0x05,0x06,0x05,0x6c,0x6b,0x6b,0x6a,0x6d,0x6b,0x6b,0x6b,0x6a,0x6b,
-0x05,0x06,0x06,0x06,0x05,0x1a,0x6c,0x6c,0x6d,0x6d,0x6b,0x6c,0x6d,0x6b,0x6b,0x6b,
-0x05,0x05,0x05,0x05,0x05,0x04,0x04,0x6b,0x6b,0x6c,0x6c,0x6c,0x6b,0x6b,0x6c,0x6d,
-0x05,0x05,0x06,0x05,0x06,0x06,0x05,0x6d,0x6c,0x6c,0x6b,0x6a,0x6d,0x6b,0x6b,0x6b,
-0x06,0x06,0x06,0x06,0x05,0x04,0x04,0x04,0x6b,0x6a,0x6c,0x6b,0x6c,0x6d,0x6c,0x6a,
-0x05,0x05,0x05,0x05,0x05,0x06,0x06,0x06,0x05,0x6a,0x6b,0x6b,0x6d,0x6b,0x6a,0x6a,
-0x05,0x05,0x06,0x05,0x05,0x06,0x06,0x06,0x05,0x6a,0x6b,0x6b,0x6d,0x6c,0x6a,0x19,
-0x06,0x06,0x05,0x06,0x05,0x04,0x04,0x04,0x04,0x04,0x04,0x1a,0x6a,0x6b,0x6b,0x6a,
-0x05,0x04,0x04,0x04,0x04,0x05,0x05,0x06,0x05,0x05,0x05,0x06,0x06,0x6a,0x6c,0x6b,
-0x06,0x05,0x05,0x05,0x05,0x06,0x04,0x05,0x06,0x06,0x06,0x04,0x1a,0x6b,0x6b,0x6a,
-0x05,0x05,0x04,0x04,0x04,0x04,0x05,0x05,0x05,0x05,0x05,0x05,0x04,0x6a,0x6d,0x6b,
-0x06,0x06,0x06,0x05,0x06,0x05,0x06,0x05,0x05,0x05,0x06,0x06,0x06,0x1a,0x6c,0x6a,
-0x05,0x05,0x05,0x06,0x06,0x05,0x05,0x05,0x05,0x04,0x04,0x04,0x03,0x6a,0x6b,0x6a,
-0x04,0x04,0x04,0x04,0x04,0x04,0x05,0x05,0x06,0x06,0x06,0x05,0x04,0x04,0x04,0x19,
-
-0x6b,0x6c,0x6b,0x6a,0x6b,0x6b,0x6d,0x6b,0x6b,0x6b,0x6b,0x6c,0x6c,0x6b,0x0a,0x0a,
-0x6d,0x6c,0x6b,0x6b,0x6b,0x6b,0x6c,0x6b,0x6d,0x6b,0x6b,0x6a,0x63,0x15,0x15,0x15,
-0x6c,0x6b,0x6c,0x6b,0x6c,0x6b,0x6c,0x6d,0x6c,0x1a,0x6b,0x6d,0x16,0x16,0x15,0x15,
-0x6a,0x6b,0x6b,0x6a,0x6b,0x6c,0x6b,0x6c,0x1b,0x6d,0x6b,0x0a,0x15,0x15,0x16,0x15,
-0x6b,0x6d,0x6d,0x6d,0x6b,0x6c,0x6b,0x6b,0x6b,0x6c,0x6d,0x63,0x15,0x15,0x15,0x16,
-0x6c,0x6c,0x6c,0x6c,0x6c,0x6b,0x6a,0x6a,0x6b,0x6c,0x6c,0x63,0x64,0x64,0x64,0x16,
-0x6b,0x6b,0x6c,0x6c,0x6b,0x6d,0x6a,0x6b,0x6d,0x6b,0x6b,0x0a,0x63,0x64,0x64,0x64,
-0x6b,0x6b,0x6a,0x6b,0x6b,0x6c,0x6b,0x6b,0x6b,0x1a,0x6b,0x15,0x64,0x0b,0x64,0x63,
-0x6a,0x6b,0x6a,0x6a,0x6a,0x6c,0x6c,0x6b,0x63,0x63,0x63,0x16,0x15,0x15,0x64,0x0a,
-0x6a,0x6d,0x6b,0x6b,0x6b,0x6a,0x6a,0x64,0x16,0x15,0x15,0x15,0x16,0x15,0x15,0x63,
-0x6b,0x6c,0x6b,0x6a,0x6b,0x6b,0x15,0x16,0x14,0x63,0x63,0x64,0x64,0x15,0x16,0x63,
-0x6b,0x6c,0x1b,0x6b,0x6c,0x15,0x16,0x63,0x63,0x63,0x0a,0x15,0x15,0x15,0x16,0x63,
-0x6c,0x1a,0x6c,0x6d,0x63,0x16,0x63,0x63,0x0a,0x0a,0x0a,0x15,0x15,0x15,0x16,0x63,
-0x6b,0x6c,0x6b,0x63,0x16,0x15,0x63,0x0a,0x0a,0x0a,0x0a,0x15,0x15,0x15,0x15,0x63,
-0x6a,0x6c,0x6b,0x63,0x16,0x63,0x0a,0x0a,0x0a,0x3e,0x0a,0x15,0x15,0x64,0x15,0x63,
-0x6a,0x6b,0x63,0x15,0x15,0x63,0x0a,0x0b,0x3d,0x2b,0x0b,0x14,0x15,0x64,0x15,0x63,
+extern const uint8_t tiles[17 * 16 * 16];
 
-0x0a,0x0a,0x6b,0x6a,0x6b,0x6b,0x6d,0x6b,0x6b,0x6b,0x6b,0x6c,0x6c,0x6b,0x6c,0x6b,
-0x15,0x65,0x0b,0x6b,0x6b,0x6b,0x6c,0x6b,0x6d,0x6b,0x6b,0x6a,0x6b,0x6b,0x6b,0x6a,
-0x15,0x15,0x64,0x0a,0x6c,0x6b,0x6c,0x6d,0x6c,0x1a,0x6b,0x6d,0x6a,0x6a,0x6b,0x1b,
-0x16,0x15,0x63,0x0a,0x6b,0x6c,0x6b,0x6c,0x1b,0x6d,0x6b,0x6d,0x6b,0x6d,0x6b,0x6b,
-0x63,0x0a,0x0b,0x63,0x6b,0x6c,0x6b,0x6b,0x6b,0x6c,0x6d,0x6c,0x6d,0x6c,0x6b,0x6d,
-0x0a,0x64,0x64,0x63,0x0a,0x6b,0x6a,0x6a,0x6b,0x6c,0x6c,0x6c,0x6b,0x6b,0x6a,0x6c,
-0x0a,0x65,0x63,0x0a,0x0a,0x6d,0x6a,0x6b,0x6d,0x6b,0x6b,0x6c,0x6b,0x6d,0x6c,0x6a,
-0x0a,0x64,0x0a,0x0a,0x0a,0x6c,0x6b,0x6b,0x6b,0x1a,0x6b,0x6c,0x6b,0x6b,0x6c,0x6b,
-0x0a,0x64,0x0a,0x0a,0x0a,0x63,0x6c,0x6b,0x6b,0x6a,0x6a,0x6a,0x6c,0x6c,0x6b,0x19,
-0x0a,0x64,0x0a,0x0a,0x0a,0x0a,0x0a,0x63,0x6d,0x6b,0x6c,0x6b,0x6b,0x6c,0x6c,0x6a,
-0x0a,0x64,0x0a,0x0a,0x0a,0x0a,0x63,0x64,0x63,0x6a,0x6b,0x6d,0x6b,0x6b,0x6b,0x6b,
-0x0a,0x64,0x0a,0x0a,0x0a,0x0a,0x63,0x14,0x64,0x63,0x6c,0x6c,0x6b,0x6c,0x6d,0x6c,
-0x0a,0x64,0x0a,0x0a,0x0a,0x0a,0x63,0x64,0x15,0x64,0x63,0x6b,0x6c,0x6b,0x6c,0x6b,
-0x0a,0x64,0x0a,0x0a,0x0a,0x0a,0x0a,0x63,0x64,0x15,0x64,0x63,0x6b,0x6b,0x6c,0x6c,
-0x0a,0x64,0x0a,0x0a,0x0a,0x32,0x32,0x0a,0x63,0x64,0x15,0x64,0x63,0x19,0x6b,0x6a,
-0x0a,0x64,0x0a,0x0a,0x0a,0x34,0x32,0x34,0x0a,0x63,0x16,0x15,0x64,0x02,0x1b,0x6a,
+#ifndef MAPS_EXCLUDE_gardenPath
+extern const uint8_t gardenPath[];
+extern const uint8_t gardenPathTileIds[17];
+MapEnum gardenPathEnum(uint32_t x, uint32_t y);
+extern const world::ChunkedMapData gardenPathChunked;
+extern const world::EventLayerData gardenPathEvents;
+extern const world::TriggerIndexData gardenPathTriggers;
+#endif
 
-0x6b,0x6c,0x63,0x15,0x15,0x0a,0x3c,0x2b,0x2b,0x24,0x06,0x0b,0x64,0x64,0x64,0x63,
-0x6d,0x63,0x15,0x15,0x15,0x0a,0x3c,0x2b,0x2b,0x2b,0x2b,0x3f,0x0b,0x64,0x64,0x63,
-0x6c,0x63,0x16,0x64,0x16,0x63,0x32,0x24,0x24,0x24,0x2b,0x2b,0x2b,0x06,0x3e,0x63,
-0x6a,0x64,0x16,0x64,0x15,0x16,0x2b,0x2b,0x2b,0x2b,0x2b,0x2b,0x2b,0x2b,0x32,0x32,
-0x6b,0x16,0x65,0x16,0x15,0x15,0x16,0x2b,0x2b,0x2b,0x24,0x2b,0x2b,0x2b,0x2b,0x2b,
-0x6c,0x16,0x64,0x16,0x15,0x64,0x15,0x16,0x16,0x2b,0x2b,0x2b,0x2b,0x2b,0x24,0x24,
-0x6b,0x15,0x63,0x63,0x63,0x16,0x16,0x64,0x15,0x16,0x16,0x2b,0x2b,0x2b,0x2b,0x2b,
-0x6b,0x63,0x63,0x63,0x16,0x64,0x15,0x15,0x64,0x64,0x15,0x16,0x16,0x15,0x16,0x16,
-0x6a,0x63,0x63,0x63,0x16,0x63,0x16,0x15,0x64,0x64,0x64,0x64,0x64,0x15,0x15,0x15,
-0x6a,0x6d,0x02,0x16,0x15,0x63,0x15,0x16,0x63,0x64,0x63,0x16,0x15,0x63,0x63,0x63,
-0x6b,0x6c,0x6b,0x63,0x63,0x63,0x64,0x64,0x63,0x64,0x63,0x63,0x64,0x63,0x0a,0x63,
-0x6b,0x6c,0x1b,0x02,0x63,0x0a,0x63,0x63,0x63,0x63,0x63,0x63,0x16,0x15,0x63,0x64,
-0x6c,0x1a,0x6c,0x6d,0x6b,0x02,0x64,0x63,0x16,0x16,0x64,0x63,0x15,0x64,0x63,0x63,
-0x6b,0x6c,0x6b,0x6d,0x1b,0x6c,0x02,0x63,0x15,0x16,0x63,0x63,0x64,0x63,0x63,0x15,
-0x6a,0x6c,0x6b,0x6c,0x6d,0x6c,0x6d,0x6b,0x02,0x64,0x0a,0x0a,0x63,0x0a,0x16,0x15,
-0x6a,0x6b,0x6b,0x6b,0x6c,0x1a,0x6b,0x1a,0x6c,0x6b,0x02,0x63,0x0a,0x63,0x64,0x64,
-
-0x0a,0x64,0x0a,0x0a,0x0c,0x3d,0x32,0x2b,0x34,0x63,0x64,0x15,0x0a,0x63,0x02,0x6b,
-0x0a,0x63,0x0a,0x06,0x3e,0x3c,0x32,0x32,0x2b,0x34,0x64,0x15,0x0a,0x0a,0x02,0x6a,
-0x0a,0x0c,0x3f,0x32,0x3e,0x34,0x2b,0x34,0x34,0x34,0x16,0x15,0x0a,0x0a,0x12,0x02,
-0x32,0x32,0x2b,0x24,0x3e,0x24,0x2b,0x34,0x34,0x16,0x15,0x64,0x0a,0x0a,0x0a,0x02,
-0x2b,0x3e,0x2b,0x2b,0x2b,0x2b,0x2b,0x34,0x16,0x15,0x64,0x63,0x0a,0x0b,0x0a,0x02,
-0x2b,0x33,0x2b,0x2b,0x2b,0x2b,0x16,0x16,0x15,0x64,0x12,0x63,0x64,0x12,0x0a,0x02,
-0x2b,0x2b,0x2b,0x2b,0x16,0x16,0x15,0x15,0x64,0x0a,0x0a,0x0a,0x64,0x0a,0x02,0x02,
-0x16,0x15,0x16,0x15,0x15,0x15,0x64,0x63,0x64,0x63,0x64,0x63,0x64,0x0a,0x02,0x02,
-0x15,0x15,0x15,0x63,0x63,0x63,0x0a,0x63,0x64,0x63,0x64,0x64,0x0a,0x02,0x02,0x19,
-0x63,0x63,0x0a,0x0a,0x0a,0x0a,0x63,0x0a,0x64,0x64,0x64,0x0a,0x02,0x02,0x02,0x6a,
-0x64,0x0a,0x63,0x15,0x63,0x63,0x15,0x0b,0x63,0x64,0x64,0x0a,0x02,0x02,0x6b,0x6b,
-0x64,0x63,0x15,0x15,0x64,0x15,0x65,0x64,0x0a,0x0a,0x0a,0x02,0x02,0x6c,0x6d,0x6c,
-0x64,0x63,0x64,0x64,0x64,0x63,0x64,0x64,0x0a,0x0a,0x02,0x02,0x02,0x6b,0x6c,0x6b,
-0x63,0x0a,0x64,0x64,0x63,0x0a,0x64,0x63,0x0a,0x02,0x02,0x6b,0x6b,0x6b,0x6c,0x6c,
-0x64,0x0a,0x64,0x64,0x63,0x0a,0x0a,0x02,0x02,0x02,0x6c,0x6a,0x6d,0x19,0x6b,0x6a,
-0x64,0x63,0x63,0x63,0x0a,0x02,0x02,0x1a,0x6c,0x6b,0x6c,0x6d,0x6c,0x6b,0x1b,0x6a,
-
-0x05,0x06,0x06,0x06,0x72,0x72,0x72,0x72,0x72,0x72,0x04,0x04,0x04,0x05,0x06,0x05,
-0x6d,0x6b,0x72,0x72,0x72,0x72,0x6c,0x72,0x6c,0x72,0x72,0x72,0x06,0x6b,0x6b,0x6b,
-0x6b,0x72,0x72,0x72,0x6c,0x6c,0x6c,0x6c,0x6c,0x6c,0x72,0x72,0x72,0x6c,0x6b,0x6c,
-0x6a,0x51,0x51,0x72,0x72,0x6c,0x6c,0x6c,0x6c,0x72,0x72,0x72,0x51,0x6c,0x6b,0x6b,
-0x51,0x51,0x72,0x72,0x6c,0x72,0x6c,0x6c,0x72,0x6c,0x72,0x72,0x72,0x51,0x6b,0x6d,
-0x51,0x72,0x51,0x72,0x72,0x72,0x6c,0x72,0x72,0x72,0x72,0x51,0x51,0x51,0x6b,0x6b,
-0x51,0x51,0x72,0x72,0x51,0x72,0x72,0x72,0x72,0x51,0x72,0x72,0x51,0x51,0x6d,0x6a,
-0x72,0x51,0x51,0x51,0x72,0x72,0x51,0x72,0x72,0x72,0x51,0x72,0x51,0x72,0x6b,0x6a,
-0x51,0x72,0x72,0x51,0x72,0x51,0x51,0x72,0x51,0x51,0x51,0x51,0x51,0x51,0x6b,0x19,
-0x6a,0x51,0x51,0x51,0x51,0x72,0x51,0x51,0x51,0x72,0x51,0x72,0x51,0x6c,0x6b,0x6a,
-0x6b,0x6c,0x51,0x51,0x51,0x72,0x51,0x51,0x51,0x51,0x72,0x51,0x6b,0x6b,0x6d,0x6c,
-0x6b,0x6b,0x03,0x03,0x03,0x51,0x51,0x63,0x51,0x03,0x03,0x03,0x03,0x6c,0x6c,0x6b,
-0x6b,0x03,0x03,0x03,0x03,0x51,0x63,0x63,0x51,0x03,0x03,0x03,0x03,0x03,0x6d,0x6b,
-0x6a,0x03,0x03,0x03,0x51,0x63,0x63,0x63,0x51,0x51,0x03,0x03,0x03,0x03,0x6c,0x6b,
-0x6a,0x6c,0x03,0x03,0x03,0x63,0x51,0x63,0x63,0x03,0x03,0x03,0x03,0x6a,0x6b,0x6b,
-0x6b,0x6b,0x6a,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x6d,0x6c,0x6b,0x6d,0x6a,
-
-0x05,0x06,0x06,0x06,0x05,0x05,0x05,0x05,0x05,0x05,0x04,0x04,0x04,0x05,0x06,0x05,
-0x6d,0x6b,0x6c,0x6b,0x6a,0x05,0x05,0x05,0x05,0x06,0x06,0x06,0x06,0x6b,0x6b,0x6b,
-0x6b,0x6b,0x6b,0x6b,0x6c,0x6b,0x6c,0x04,0x04,0x04,0x04,0x04,0x6b,0x6c,0x6b,0x6c,
-0x6a,0x6c,0x6b,0x6b,0x6b,0x6c,0x6b,0x6b,0x6c,0x6d,0x6b,0x6d,0x6d,0x6c,0x6b,0x6b,
-0x6d,0x6d,0x6d,0x6d,0x6b,0x6b,0x6a,0x6b,0x6a,0x6b,0x6c,0x6c,0x6c,0x6b,0x6b,0x6d,
-0x6b,0x6c,0x6d,0x6b,0x6b,0x6b,0x19,0x6b,0x6d,0x6c,0x6b,0x6b,0x6b,0x6b,0x6b,0x6b,
-0x6b,0x6b,0x6c,0x6c,0x6b,0x6d,0x6a,0x6b,0x6c,0x6b,0x6b,0x6c,0x6b,0x6c,0x6d,0x6a,
-0x6b,0x6b,0x6a,0x6b,0x6b,0x6c,0x6b,0x6a,0x6a,0x19,0x6b,0x6a,0x6b,0x6b,0x6b,0x6a,
-0x6a,0x6b,0x6b,0x6a,0x6b,0x62,0x19,0x6a,0x6d,0x6a,0x6a,0x6a,0x6b,0x6d,0x6b,0x19,
-0x6a,0x6d,0x6b,0x6b,0x6c,0x6a,0x6d,0x6b,0x6c,0x6b,0x6c,0x6c,0x6b,0x6c,0x6b,0x6a,
-0x6b,0x6c,0x6b,0x6b,0x6d,0x6b,0x6c,0x6b,0x6a,0x6a,0x6b,0x6d,0x6b,0x6b,0x6d,0x6c,
-0x6b,0x6b,0x6d,0x6b,0x6c,0x6d,0x6c,0x6b,0x6d,0x6b,0x6d,0x6c,0x6d,0x6c,0x6c,0x6b,
-0x6b,0x6a,0x6c,0x6b,0x6b,0x6b,0x6b,0x6b,0x6b,0x6a,0x6d,0x6b,0x6b,0x6b,0x6d,0x6b,
-0x6a,0x6d,0x6c,0x6c,0x6d,0x6c,0x6d,0x6b,0x6c,0x6a,0x6b,0x6b,0x6c,0x6b,0x6c,0x6b,
-0x6a,0x6c,0x6c,0x6c,0x6c,0x6b,0x6c,0x6b,0x6c,0x6b,0x6d,0x6b,0x6d,0x6a,0x6b,0x6b,
-0x6b,0x6b,0x6a,0x6b,0x6b,0x6b,0x6b,0x6b,0x6b,0x6a,0x6c,0x6d,0x6c,0x6b,0x6d,0x6a,
-
-0x03,0x04,0x05,0x06,0x05,0x05,0x05,0x05,0x05,0x05,0x04,0x04,0x04,0x05,0x06,0x06,
-0x6b,0x6b,0x6a,0x6a,0x1a,0x05,0x05,0x05,0x05,0x06,0x06,0x06,0x06,0x05,0x04,0x04,
-0x6b,0x6b,0x6b,0x6b,0x6c,0x6a,0x05,0x04,0x04,0x04,0x04,0x04,0x04,0x05,0x06,0x06,
-0x6b,0x6c,0x6b,0x6b,0x6b,0x1a,0x05,0x06,0x06,0x06,0x06,0x06,0x06,0x05,0x06,0x06,
-0x6d,0x6d,0x6d,0x6d,0x6b,0x6a,0x03,0x04,0x04,0x04,0x04,0x04,0x04,0x05,0x05,0x05,
-0x6b,0x6d,0x6d,0x6b,0x6b,0x6b,0x04,0x05,0x06,0x06,0x06,0x05,0x05,0x06,0x05,0x05,
-0x6c,0x6b,0x6c,0x6b,0x6c,0x6d,0x23,0x04,0x05,0x06,0x04,0x04,0x05,0x05,0x06,0x06,
-0x6b,0x6b,0x6a,0x6a,0x6b,0x6d,0x6b,0x6a,0x6a,0x05,0x05,0x05,0x06,0x05,0x05,0x05,
-0x6a,0x6b,0x6b,0x6a,0x6b,0x6a,0x6a,0x6b,0x6a,0x04,0x06,0x05,0x05,0x06,0x05,0x05,
-0x6c,0x6d,0x6a,0x6b,0x6a,0x6b,0x6d,0x6b,0x6c,0x6b,0x6a,0x1a,0x1a,0x04,0x05,0x06,
-0x6c,0x6c,0x6b,0x6b,0x6d,0x6b,0x6c,0x6b,0x6a,0x6b,0x6b,0x6d,0x6a,0x6a,0x04,0x06,
-0x6b,0x6b,0x6d,0x6b,0x6c,0x6b,0x6c,0x6c,0x6b,0x6d,0x6d,0x6d,0x6c,0x04,0x05,0x05,
-0x6b,0x6b,0x6c,0x6b,0x6b,0x6b,0x6a,0x6b,0x6b,0x6a,0x6d,0x6b,0x1a,0x04,0x06,0x06,
-0x6b,0x6d,0x6c,0x6c,0x6d,0x6b,0x6c,0x6b,0x6c,0x6a,0x6b,0x6b,0x6c,0x04,0x04,0x04,
-0x6a,0x6c,0x6b,0x6c,0x6c,0x6b,0x6c,0x6b,0x6c,0x6d,0x6d,0x6b,0x6c,0x1a,0x04,0x06,
-0x6b,0x6b,0x6a,0x6b,0x6c,0x6b,0x6d,0x6b,0x6b,0x6b,0x6c,0x6d,0x6c,0x6d,0x6a,0x19,
-
-0x6b,0x6c,0x6b,0x6a,0x6b,0x6b,0x6d,0x6b,0x6b,0x6b,0x6b,0x6c,0x6c,0x6b,0x6c,0x6b,
-0x6d,0x6c,0x6b,0x6b,0x6b,0x6b,0x6c,0x6b,0x6d,0x6b,0x6b,0x6a,0x6b,0x6b,0x6b,0x6a,
-0x6c,0x6b,0x6c,0x6b,0x6c,0x6b,0x6c,0x6d,0x6c,0x1a,0x6b,0x6d,0x6a,0x6a,0x6b,0x1b,
-0x6a,0x6b,0x6b,0x6a,0x6b,0x6c,0x6b,0x6c,0x1b,0x6d,0x6b,0x6d,0x6b,0x6d,0x6b,0x6b,
-0x6b,0x6d,0x6d,0x6d,0x6b,0x6c,0x6b,0x6b,0x6b,0x6c,0x6d,0x6c,0x6d,0x6c,0x6b,0x6d,
-0x6c,0x6c,0x6c,0x6c,0x6c,0x6b,0x6a,0x6a,0x6b,0x6c,0x6c,0x6c,0x6b,0x6b,0x6a,0x6c,
-0x6b,0x6b,0x6c,0x6c,0x6b,0x6d,0x6a,0x6b,0x6d,0x6b,0x6b,0x6c,0x6b,0x6d,0x6c,0x6a,
-0x6b,0x6b,0x6a,0x6b,0x6b,0x6c,0x6b,0x6b,0x6b,0x1a,0x6b,0x6c,0x6b,0x6b,0x6c,0x6b,
-0x6a,0x6b,0x6a,0x6a,0x6a,0x6c,0x6c,0x6b,0x6b,0x6a,0x6a,0x6a,0x6c,0x6c,0x6b,0x19,
-0x6a,0x6d,0x6b,0x6b,0x6b,0x6a,0x6a,0x6a,0x6d,0x6b,0x6c,0x6b,0x6b,0x6c,0x6c,0x6a,
-0x6b,0x6c,0x6b,0x6a,0x6b,0x6b,0x6c,0x6b,0x6b,0x6a,0x6b,0x6d,0x6b,0x6b,0x6b,0x6b,
-0x6b,0x6c,0x1b,0x6b,0x6c,0x6d,0x6c,0x6b,0x6d,0x6b,0x6c,0x6c,0x6b,0x6c,0x6d,0x6c,
-0x6c,0x1a,0x6c,0x6d,0x6b,0x6b,0x6c,0x6b,0x6c,0x6b,0x6d,0x6b,0x6c,0x6b,0x6c,0x6b,
-0x6b,0x0b,0x0b,0x0b,0x0b,0x0b,0x0b,0x0b,0x0b,0x0b,0x0b,0x0b,0x0b,0x0b,0x0b,0x0b,
-0x6a,0x65,0x65,0x65,0x65,0x64,0x64,0x65,0x65,0x65,0x65,0x65,0x64,0x65,0x64,0x65,
-0x6a,0x13,0x64,0x65,0x64,0x64,0x64,0x65,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,
-
-0x6b,0x6c,0x6b,0x6a,0x72,0x72,0x72,0x72,0x72,0x72,0x6b,0x6c,0x6c,0x6b,0x6c,0x6b,
-0x6d,0x6c,0x72,0x72,0x72,0x72,0x6c,0x72,0x6c,0x72,0x72,0x72,0x6b,0x6b,0x6b,0x6a,
-0x6c,0x72,0x72,0x72,0x6c,0x6c,0x6c,0x6c,0x6c,0x6c,0x72,0x72,0x72,0x6a,0x6b,0x1b,
-0x6a,0x51,0x51,0x72,0x72,0x6c,0x6c,0x6c,0x6c,0x72,0x72,0x72,0x51,0x6d,0x6b,0x6b,
-0x51,0x51,0x72,0x72,0x6c,0x72,0x6c,0x6c,0x72,0x6c,0x72,0x72,0x72,0x51,0x6b,0x6d,
-0x51,0x72,0x51,0x72,0x72,0x72,0x6c,0x72,0x72,0x72,0x72,0x51,0x51,0x51,0x6a,0x6c,
-0x51,0x51,0x72,0x72,0x51,0x72,0x72,0x72,0x72,0x51,0x72,0x72,0x51,0x51,0x6c,0x6a,
-0x72,0x51,0x51,0x51,0x72,0x72,0x51,0x72,0x72,0x72,0x51,0x72,0x51,0x72,0x6c,0x6b,
-0x51,0x72,0x72,0x51,0x72,0x51,0x51,0x72,0x51,0x51,0x51,0x51,0x51,0x51,0x6b,0x19,
-0x6a,0x51,0x51,0x51,0x51,0x72,0x51,0x51,0x51,0x72,0x51,0x72,0x51,0x6c,0x6c,0x6a,
-0x6b,0x6c,0x51,0x51,0x51,0x72,0x51,0x51,0x51,0x51,0x72,0x51,0x6b,0x6b,0x6b,0x6b,
-0x6b,0x6c,0x03,0x03,0x03,0x51,0x51,0x63,0x51,0x03,0x03,0x03,0x03,0x6c,0x6d,0x6c,
-0x6c,0x03,0x03,0x03,0x03,0x51,0x63,0x63,0x51,0x03,0x03,0x03,0x03,0x03,0x6c,0x6b,
-0x0b,0x0b,0x0b,0x0b,0x0b,0x0b,0x0b,0x0b,0x0b,0x0b,0x0b,0x0b,0x0b,0x0b,0x0b,0x6c,
-0x65,0x65,0x65,0x65,0x65,0x65,0x64,0x64,0x65,0x65,0x64,0x65,0x65,0x65,0x65,0x6a,
-0x64,0x64,0x64,0x65,0x64,0x64,0x66,0x66,0x65,0x64,0x65,0x64,0x65,0x64,0x64,0x6a,
-
-0x6d,0x63,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,
-0x6d,0x13,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,
-0x6b,0x6b,0x6b,0x6b,0x6c,0x62,0x6c,0x6c,0x6b,0x6a,0x6b,0x6d,0x6b,0x6c,0x6b,0x6c,
-0x6b,0x6c,0x6b,0x6b,0x6b,0x63,0x63,0x6b,0x6c,0x6d,0x6c,0x6c,0x6d,0x6c,0x6b,0x6b,
-0x6d,0x63,0x64,0x64,0x64,0x64,0x64,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,
-0x6b,0x63,0x63,0x63,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,
-0x6b,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,
-0x6b,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,
-0x6a,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,
-0x6a,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,
-0x6b,0x62,0x62,0x62,0x61,0x62,0x61,0x61,0x61,0x61,0x61,0x61,0x61,0x61,0x61,0x61,
-0x6b,0x6b,0x62,0x62,0x62,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
-0x6b,0x6a,0x64,0x62,0x62,0x62,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,
-0x6b,0x6d,0x64,0x62,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
-0x19,0x62,0x63,0x02,0x02,0x1b,0x05,0x06,0x05,0x04,0x6c,0x6b,0x6d,0x05,0x05,0x6a,
-0x04,0x04,0x04,0x04,0x04,0x04,0x05,0x05,0x06,0x06,0x06,0x05,0x04,0x04,0x04,0x04,
-
-0x64,0x64,0x65,0x65,0x64,0x64,0x64,0x65,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x6a,
-0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x6b,
-0x6b,0x6b,0x6b,0x6b,0x6c,0x6d,0x6c,0x6c,0x6b,0x6a,0x62,0x62,0x6b,0x6c,0x6b,0x6c,
-0x6b,0x6c,0x6b,0x6b,0x6b,0x6c,0x6b,0x6b,0x6c,0x6d,0x62,0x63,0x6d,0x6c,0x6b,0x6b,
-0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x64,0x64,0x63,0x6d,
-0x64,0x63,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x63,0x63,0x63,0x64,0x64,0x6b,
-0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x02,
-0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x02,
-0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x02,
-0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x02,
-0x61,0x61,0x61,0x61,0x61,0x61,0x61,0x61,0x61,0x61,0x61,0x61,0x61,0x61,0x62,0x02,
-0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x63,0x62,0x02,0x02,
-0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x62,0x62,0x63,0x62,0x02,
-0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x63,0x62,0x02,
-0x19,0x6c,0x05,0x06,0x6c,0x1b,0x05,0x06,0x05,0x04,0x6c,0x6b,0x6d,0x62,0x62,0x02,
-0x04,0x04,0x04,0x04,0x04,0x04,0x05,0x05,0x06,0x06,0x06,0x05,0x04,0x04,0x04,0x04,
-
-};
+// Every map of the build, followed by an empty entry.
+extern const world::MapTableEntry mapTable[];
+extern const uint32_t mapCount;
@@ -0,0 +1,10 @@
+// Generated File - DO NOT EDIT
+#include "maps.h"
+
+const world::MapTableEntry mapTable[] = {
+#ifndef MAPS_EXCLUDE_gardenPath
+    {"gardenPath", gardenPath, gardenPathTileIds, sizeof(gardenPathTileIds), &gardenPathChunked, &gardenPathEvents, &gardenPathTriggers},
+#endif
+    {}
+};
+const uint32_t mapCount = sizeof(mapTable) / sizeof(mapTable[0]) - 1;
@@ -0,0 +1,294 @@
+// Generated File - DO NOT EDIT
+#include "maps.h"
+
+const uint8_t tiles[] = {
+0x6b,0x6c,0x6b,0x6a,0x72,0x72,0x72,0x72,0x72,0x72,0x6b,0x6c,0x6c,0x6b,0x6c,0x6b,
+0x6d,0x6c,0x72,0x72,0x72,0x72,0x6c,0x72,0x6c,0x72,0x72,0x72,0x6b,0x6b,0x6b,0x6a,
+0x6c,0x72,0x72,0x72,0x6c,0x6c,0x6c,0x6c,0x6c,0x6c,0x72,0x72,0x72,0x6a,0x6b,0x1b,
+0x6a,0x51,0x51,0x72,0x72,0x6c,0x6c,0x6c,0x6c,0x72,0x72,0x72,0x51,0x6d,0x6b,0x6b,
+0x51,0x51,0x72,0x72,0x6c,0x72,0x6c,0x6c,0x72,0x6c,0x72,0x72,0x72,0x51,0x6b,0x6d,
+0x51,0x72,0x51,0x72,0x72,0x72,0x6c,0x72,0x72,0x72,0x72,0x51,0x51,0x51,0x6a,0x6c,
+0x51,0x51,0x72,0x72,0x51,0x72,0x72,0x72,0x72,0x51,0x72,0x72,0x51,0x51,0x6c,0x6a,
+0x72,0x51,0x51,0x51,0x72,0x72,0x51,0x72,0x72,0x72,0x51,0x72,0x51,0x72,0x6c,0x6b,
+0x51,0x72,0x72,0x51,0x72,0x51,0x51,0x72,0x51,0x51,0x51,0x51,0x51,0x51,0x6b,0x19,
+0x6a,0x51,0x51,0x51,0x51,0x72,0x51,0x51,0x51,0x72,0x51,0x72,0x51,0x6c,0x6c,0x6a,
+0x6b,0x6c,0x51,0x51,0x51,0x72,0x51,0x51,0x51,0x51,0x72,0x51,0x6b,0x6b,0x6b,0x6b,
+0x6b,0x6c,0x03,0x03,0x03,0x51,0x51,0x63,0x51,0x03,0x03,0x03,0x03,0x6c,0x6d,0x6c,
+0x6c,0x03,0x03,0x03,0x03,0x51,0x63,0x63,0x51,0x03,0x03,0x03,0x03,0x03,0x6c,0x6b,
+0x6b,0x03,0x03,0x03,0x51,0x63,0x63,0x63,0x51,0x51,0x03,0x03,0x03,0x03,0x6c,0x6c,
+0x6a,0x6c,0x03,0x03,0x03,0x63,0x51,0x63,0x63,0x03,0x03,0x03,0x03,0x19,0x6b,0x6a,
+0x6a,0x6b,0x6b,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x6d,0x6c,0x6b,0x1b,0x6a,
+
+0x6b,0x6c,0x6b,0x6a,0x6b,0x6b,0x6d,0x6b,0x6b,0x6b,0x6b,0x6c,0x6c,0x6b,0x6c,0x6b,
+0x6d,0x6c,0x6b,0x6b,0x6b,0x6b,0x6c,0x6b,0x6d,0x6b,0x6b,0x6a,0x6b,0x6b,0x6b,0x6a,
+0x6c,0x6b,0x6c,0x6b,0x6c,0x6b,0x6c,0x6d,0x6c,0x1a,0x6b,0x6d,0x6a,0x6a,0x6b,0x1b,
+0x6a,0x6b,0x6b,0x6a,0x6b,0x6c,0x6b,0x6c,0x1b,0x6d,0x6b,0x6d,0x6b,0x6d,0x6b,0x6b,
+0x6b,0x6d,0x6d,0x6d,0x6b,0x6c,0x6b,0x6b,0x6b,0x6c,0x6d,0x6c,0x6d,0x6c,0x6b,0x6d,
+0x6c,0x6c,0x6c,0x6c,0x6c,0x6b,0x6a,0x6a,0x6b,0x6c,0x6c,0x6c,0x6b,0x6b,0x6a,0x6c,
+0x6b,0x6b,0x6c,0x6c,0x6b,0x6d,0x6a,0x6b,0x6d,0x6b,0x6b,0x6c,0x6b,0x6d,0x6c,0x6a,
+0x6b,0x6b,0x6a,0x6b,0x6b,0x6c,0x6b,0x6b,0x6b,0x1a,0x6b,0x6c,0x6b,0x6b,0x6c,0x6b,
+0x6a,0x6b,0x6a,0x6a,0x6a,0x6c,0x6c,0x6b,0x6b,0x6a,0x6a,0x6a,0x6c,0x6c,0x6b,0x19,
+0x6a,0x6d,0x6b,0x6b,0x6b,0x6a,0x6a,0x6a,0x6d,0x6b,0x6c,0x6b,0x6b,0x6c,0x6c,0x6a,
+0x6b,0x6c,0x6b,0x6a,0x6b,0x6b,0x6c,0x6b,0x6b,0x6a,0x6b,0x6d,0x6b,0x6b,0x6b,0x6b,
+0x6b,0x6c,0x1b,0x6b,0x6c,0x6d,0x6c,0x6b,0x6d,0x6b,0x6c,0x6c,0x6b,0x6c,0x6d,0x6c,
+0x6c,0x1a,0x6c,0x6d,0x6b,0x6b,0x6c,0x6b,0x6c,0x6b,0x6d,0x6b,0x6c,0x6b,0x6c,0x6b,
+0x6b,0x6c,0x6b,0x6d,0x1b,0x6c,0x6b,0x6a,0x6b,0x6a,0x6b,0x6b,0x6b,0x6b,0x6c,0x6c,
+0x6a,0x6c,0x6b,0x6c,0x6d,0x6c,0x6d,0x6b,0x6d,0x6b,0x6c,0x6a,0x6d,0x19,0x6b,0x6a,
+0x6a,0x6b,0x6b,0x6b,0x6c,0x1a,0x6b,0x1a,0x6c,0x6b,0x6c,0x6d,0x6c,0x6b,0x1b,0x6a,
+
+0x6d,0x6c,0x6b,0x6b,0x72,0x72,0x72,0x72,0x72,0x72,0x6b,0x6c,0x6c,0x6b,0x6c,0x6a,
+0x6d,0x6b,0x72,0x72,0x72,0x72,0x6c,0x72,0x6c,0x72,0x72,0x72,0x6b,0x6b,0x6b,0x6b,
+0x6b,0x72,0x72,0x72,0x6c,0x6c,0x6c,0x6c,0x6c,0x6c,0x72,0x72,0x72,0x6c,0x6b,0x6c,
+0x6b,0x51,0x51,0x72,0x72,0x6c,0x6c,0x6c,0x6c,0x72,0x72,0x72,0x51,0x6c,0x6b,0x6b,
+0x51,0x51,0x72,0x72,0x6c,0x72,0x6c,0x6c,0x72,0x6c,0x72,0x72,0x72,0x51,0x6b,0x6d,
+0x51,0x72,0x51,0x72,0x72,0x72,0x6c,0x72,0x72,0x72,0x72,0x51,0x51,0x51,0x6b,0x6b,
+0x51,0x51,0x72,0x72,0x51,0x72,0x72,0x72,0x72,0x51,0x72,0x72,0x51,0x51,0x6d,0x6a,
+0x72,0x51,0x51,0x51,0x72,0x72,0x51,0x72,0x72,0x72,0x51,0x72,0x51,0x72,0x6b,0x6a,
+0x51,0x72,0x72,0x51,0x72,0x51,0x51,0x72,0x51,0x51,0x51,0x51,0x51,0x51,0x6b,0x19,
+0x6a,0x51,0x51,0x51,0x51,0x72,0x51,0x51,0x51,0x72,0x51,0x72,0x51,0x6c,0x6b,0x6b,
+0x6b,0x6c,0x51,0x51,0x51,0x72,0x51,0x51,0x51,0x51,0x72,0x51,0x6b,0x6b,0x6d,0x6c,
+0x6b,0x6b,0x03,0x03,0x03,0x51,0x51,0x63,0x51,0x03,0x03,0x03,0x03,0x6c,0x6c,0x6b,
+0x6b,0x03,0x03,0x03,0x03,0x51,0x63,0x63,0x51,0x03,0x03,0x03,0x03,0x03,0x6d,0x6b,
+0x6b,0x03,0x03,0x03,0x51,0x63,0x63,0x63,0x51,0x51,0x03,0x03,0x03,0x03,0x6c,0x6b,
+0x19,0x6c,0x03,0x03,0x03,0x63,0x51,0x63,0x63,0x03,0x03,0x03,0x03,0x05,0x05,0x6a,
+0x04,0x04,0x04,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x05,0x04,0x04,0x04,0x04,
+
+0x6d,0x6c,0x6b,0x6b,0x6c,0x6b,0x6d,0x6b,0x6d,0x6b,0x6b,0x6c,0x6c,0x6b,0x6c,0x6a,
+0x6d,0x6b,0x6c,0x6b,0x6b,0x6b,0x6c,0x6d,0x6c,0x6a,0x6b,0x6b,0x6b,0x6b,0x6b,0x6b,
+0x6b,0x6b,0x6b,0x6b,0x6c,0x6d,0x6c,0x6c,0x6b,0x6a,0x6b,0x6d,0x6b,0x6c,0x6b,0x6c,
+0x6b,0x6c,0x6b,0x6b,0x6b,0x6c,0x6b,0x6b,0x6c,0x6d,0x6c,0x6c,0x6d,0x6c,0x6b,0x6b,
+0x6d,0x6d,0x6d,0x6d,0x6b,0x6b,0x6a,0x6b,0x6a,0x6b,0x6c,0x6c,0x6c,0x6b,0x6b,0x6d,
+0x6b,0x6c,0x6d,0x6b,0x6b,0x6b,0x6a,0x6b,0x6d,0x6c,0x6b,0x6b,0x6b,0x6d,0x6b,0x6b,
+0x6b,0x6b,0x6b,0x6b,0x6b,0x6d,0x6a,0x6b,0x6b,0x6a,0x6b,0x6c,0x6b,0x6c,0x6d,0x6a,
+0x6b,0x6b,0x6a,0x6b,0x6b,0x6c,0x6b,0x6a,0x6a,0x19,0x6b,0x6a,0x6b,0x6b,0x6b,0x6a,
+0x6a,0x6b,0x6b,0x6a,0x6b,0x6a,0x19,0x6a,0x6d,0x6a,0x6a,0x6a,0x6b,0x6d,0x6b,0x19,
+0x6a,0x6d,0x6b,0x6b,0x6c,0x6b,0x6c,0x6b,0x6c,0x6b,0x6b,0x6c,0x6b,0x6c,0x6b,0x6b,
+0x6b,0x6c,0x6b,0x6b,0x6d,0x6b,0x6c,0x6b,0x6a,0x6a,0x6b,0x6d,0x6b,0x6b,0x6d,0x6c,
+0x6b,0x6b,0x6c,0x6b,0x6c,0x1b,0x6c,0x6b,0x6d,0x6b,0x6d,0x6c,0x6c,0x6c,0x6c,0x6b,
+0x6b,0x6a,0x6c,0x6b,0x6b,0x6b,0x6b,0x6b,0x6b,0x6a,0x6c,0x6b,0x6b,0x6b,0x6d,0x6b,
+0x6b,0x6d,0x6c,0x6c,0x6d,0x6b,0x6d,0x6b,0x6c,0x6a,0x6b,0x6b,0x6c,0x6b,0x6c,0x6b,
+0x19,0x6c,0x05,0x06,0x6c,0x1b,0x05,0x06,0x05,0x04,0x6c,0x6b,0x6d,0x05,0x05,0x6a,
+0x04,0x04,0x04,0x04,0x04,0x04,0x05,0x05,0x06,0x06,0x06,0x05,0x04,0x04,0x04,0x04,
+
+0x06,0x06,0x06,0x05,0x05,0x05,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x05,0x06,0x06,
+0x06,0x06,0x04,0x04,0x04,0x05,0x05,0x05,0x05,0x06,0x06,0x06,0x06,0x05,0x04,0x05,
+0x05,0x05,0x05,0x05,0x06,0x05,0x05,0x05,0x06,0x06,0x06,0x06,0x06,0x05,0x06,0x06,
+0x05,0x06,0x06,0x06,0x06,0x06,0x05,0x06,0x06,0x06,0x06,0x06,0x05,0x05,0x06,0x06,
+0x05,0x04,0x04,0x04,0x04,0x04,0x05,0x04,0x06,0x06,0x06,0x06,0x06,0x04,0x05,0x05,
+0x05,0x05,0x06,0x05,0x06,0x06,0x05,0x04,0x06,0x06,0x06,0x05,0x05,0x06,0x05,0x05,
+0x06,0x06,0x06,0x06,0x06,0x06,0x05,0x05,0x05,0x06,0x06,0x06,0x05,0x05,0x06,0x06,
+0x05,0x04,0x04,0x04,0x04,0x06,0x06,0x06,0x05,0x05,0x05,0x05,0x06,0x05,0x05,0x05,
+0x05,0x05,0x06,0x05,0x05,0x06,0x06,0x06,0x06,0x05,0x06,0x05,0x05,0x06,0x06,0x05,
+0x06,0x06,0x05,0x06,0x04,0x04,0x04,0x04,0x04,0x04,0x05,0x06,0x06,0x06,0x04,0x06,
+0x06,0x06,0x06,0x06,0x06,0x06,0x04,0x05,0x05,0x05,0x05,0x06,0x06,0x04,0x04,0x06,
+0x06,0x05,0x05,0x05,0x05,0x04,0x04,0x05,0x06,0x06,0x06,0x06,0x06,0x05,0x04,0x04,
+0x05,0x06,0x05,0x06,0x06,0x05,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x06,0x06,
+0x06,0x06,0x06,0x05,0x06,0x05,0x05,0x05,0x05,0x05,0x06,0x06,0x06,0x05,0x05,0x04,
+0x05,0x05,0x05,0x06,0x06,0x04,0x05,0x04,0x05,0x06,0x06,0x06,0x06,0x04,0x04,0x06,
+0x06,0x06,0x06,0x06,0x04,0x04,0x05,0x05,0x06,0x06,0x06,0x06,0x05,0x05,0x06,0x06,
+
+0x04,0x6b,0x6a,0x6b,0x6d,0x6b,0x6c,0x6b,0x6d,0x6a,0x6c,0x6b,0x6b,0x6c,0x6b,0x6a,
+0x05,0x05,0x05,0x05,0x04,0x6b,0x6c,0x6d,0x6b,0x19,0x6b,0x6b,0x6a,0x6b,0x6b,0x6d,
+0x05,0x05,0x05,0x05,0x06,0x05,0x6c,0x6b,0x6b,0x6a,0x6d,0x6b,0x6b,0x6b,0x6a,0x6b,
+0x05,0x06,0x06,0x06,0x05,0x1a,0x6c,0x6c,0x6d,0x6d,0x6b,0x6c,0x6d,0x6b,0x6b,0x6b,
+0x05,0x05,0x05,0x05,0x05,0x04,0x04,0x6b,0x6b,0x6c,0x6c,0x6c,0x6b,0x6b,0x6c,0x6d,
+0x05,0x05,0x06,0x05,0x06,0x06,0x05,0x6d,0x6c,0x6c,0x6b,0x6a,0x6d,0x6b,0x6b,0x6b,
+0x06,0x06,0x06,0x06,0x05,0x04,0x04,0x04,0x6b,0x6a,0x6c,0x6b,0x6c,0x6d,0x6c,0x6a,
+0x05,0x05,0x05,0x05,0x05,0x06,0x06,0x06,0x05,0x6a,0x6b,0x6b,0x6d,0x6b,0x6a,0x6a,
+0x05,0x05,0x06,0x05,0x05,0x06,0x06,0x06,0x05,0x6a,0x6b,0x6b,0x6d,0x6c,0x6a,0x19,
+0x06,0x06,0x05,0x06,0x05,0x04,0x04,0x04,0x04,0x04,0x04,0x1a,0x6a,0x6b,0x6b,0x6a,
+0x05,0x04,0x04,0x04,0x04,0x05,0x05,0x06,0x05,0x05,0x05,0x06,0x06,0x6a,0x6c,0x6b,
+0x06,0x05,0x05,0x05,0x05,0x06,0x04,0x05,0x06,0x06,0x06,0x04,0x1a,0x6b,0x6b,0x6a,
+0x05,0x05,0x04,0x04,0x04,0x04,0x05,0x05,0x05,0x05,0x05,0x05,0x04,0x6a,0x6d,0x6b,
+0x06,0x06,0x06,0x05,0x06,0x05,0x06,0x05,0x05,0x05,0x06,0x06,0x06,0x1a,0x6c,0x6a,
+0x05,0x05,0x05,0x06,0x06,0x05,0x05,0x05,0x05,0x04,0x04,0x04,0x03,0x6a,0x6b,0x6a,
+0x04,0x04,0x04,0x04,0x04,0x04,0x05,0x05,0x06,0x06,0x06,0x05,0x04,0x04,0x04,0x19,
+
+0x6b,0x6c,0x6b,0x6a,0x6b,0x6b,0x6d,0x6b,0x6b,0x6b,0x6b,0x6c,0x6c,0x6b,0x0a,0x0a,
+0x6d,0x6c,0x6b,0x6b,0x6b,0x6b,0x6c,0x6b,0x6d,0x6b,0x6b,0x6a,0x63,0x15,0x15,0x15,
+0x6c,0x6b,0x6c,0x6b,0x6c,0x6b,0x6c,0x6d,0x6c,0x1a,0x6b,0x6d,0x16,0x16,0x15,0x15,
+0x6a,0x6b,0x6b,0x6a,0x6b,0x6c,0x6b,0x6c,0x1b,0x6d,0x6b,0x0a,0x15,0x15,0x16,0x15,
+0x6b,0x6d,0x6d,0x6d,0x6b,0x6c,0x6b,0x6b,0x6b,0x6c,0x6d,0x63,0x15,0x15,0x15,0x16,
+0x6c,0x6c,0x6c,0x6c,0x6c,0x6b,0x6a,0x6a,0x6b,0x6c,0x6c,0x63,0x64,0x64,0x64,0x16,
+0x6b,0x6b,0x6c,0x6c,0x6b,0x6d,0x6a,0x6b,0x6d,0x6b,0x6b,0x0a,0x63,0x64,0x64,0x64,
+0x6b,0x6b,0x6a,0x6b,0x6b,0x6c,0x6b,0x6b,0x6b,0x1a,0x6b,0x15,0x64,0x0b,0x64,0x63,
+0x6a,0x6b,0x6a,0x6a,0x6a,0x6c,0x6c,0x6b,0x63,0x63,0x63,0x16,0x15,0x15,0x64,0x0a,
+0x6a,0x6d,0x6b,0x6b,0x6b,0x6a,0x6a,0x64,0x16,0x15,0x15,0x15,0x16,0x15,0x15,0x63,
+0x6b,0x6c,0x6b,0x6a,0x6b,0x6b,0x15,0x16,0x14,0x63,0x63,0x64,0x64,0x15,0x16,0x63,
+0x6b,0x6c,0x1b,0x6b,0x6c,0x15,0x16,0x63,0x63,0x63,0x0a,0x15,0x15,0x15,0x16,0x63,
+0x6c,0x1a,0x6c,0x6d,0x63,0x16,0x63,0x63,0x0a,0x0a,0x0a,0x15,0x15,0x15,0x16,0x63,
+0x6b,0x6c,0x6b,0x63,0x16,0x15,0x63,0x0a,0x0a,0x0a,0x0a,0x15,0x15,0x15,0x15,0x63,
+0x6a,0x6c,0x6b,0x63,0x16,0x63,0x0a,0x0a,0x0a,0x3e,0x0a,0x15,0x15,0x64,0x15,0x63,
+0x6a,0x6b,0x63,0x15,0x15,0x63,0x0a,0x0b,0x3d,0x2b,0x0b,0x14,0x15,0x64,0x15,0x63,
+
+0x0a,0x0a,0x6b,0x6a,0x6b,0x6b,0x6d,0x6b,0x6b,0x6b,0x6b,0x6c,0x6c,0x6b,0x6c,0x6b,
+0x15,0x65,0x0b,0x6b,0x6b,0x6b,0x6c,0x6b,0x6d,0x6b,0x6b,0x6a,0x6b,0x6b,0x6b,0x6a,
+0x15,0x15,0x64,0x0a,0x6c,0x6b,0x6c,0x6d,0x6c,0x1a,0x6b,0x6d,0x6a,0x6a,0x6b,0x1b,
+0x16,0x15,0x63,0x0a,0x6b,0x6c,0x6b,0x6c,0x1b,0x6d,0x6b,0x6d,0x6b,0x6d,0x6b,0x6b,
+0x63,0x0a,0x0b,0x63,0x6b,0x6c,0x6b,0x6b,0x6b,0x6c,0x6d,0x6c,0x6d,0x6c,0x6b,0x6d,
+0x0a,0x64,0x64,0x63,0x0a,0x6b,0x6a,0x6a,0x6b,0x6c,0x6c,0x6c,0x6b,0x6b,0x6a,0x6c,
+0x0a,0x65,0x63,0x0a,0x0a,0x6d,0x6a,0x6b,0x6d,0x6b,0x6b,0x6c,0x6b,0x6d,0x6c,0x6a,
+0x0a,0x64,0x0a,0x0a,0x0a,0x6c,0x6b,0x6b,0x6b,0x1a,0x6b,0x6c,0x6b,0x6b,0x6c,0x6b,
+0x0a,0x64,0x0a,0x0a,0x0a,0x63,0x6c,0x6b,0x6b,0x6a,0x6a,0x6a,0x6c,0x6c,0x6b,0x19,
+0x0a,0x64,0x0a,0x0a,0x0a,0x0a,0x0a,0x63,0x6d,0x6b,0x6c,0x6b,0x6b,0x6c,0x6c,0x6a,
+0x0a,0x64,0x0a,0x0a,0x0a,0x0a,0x63,0x64,0x63,0x6a,0x6b,0x6d,0x6b,0x6b,0x6b,0x6b,
+0x0a,0x64,0x0a,0x0a,0x0a,0x0a,0x63,0x14,0x64,0x63,0x6c,0x6c,0x6b,0x6c,0x6d,0x6c,
+0x0a,0x64,0x0a,0x0a,0x0a,0x0a,0x63,0x64,0x15,0x64,0x63,0x6b,0x6c,0x6b,0x6c,0x6b,
+0x0a,0x64,0x0a,0x0a,0x0a,0x0a,0x0a,0x63,0x64,0x15,0x64,0x63,0x6b,0x6b,0x6c,0x6c,
+0x0a,0x64,0x0a,0x0a,0x0a,0x32,0x32,0x0a,0x63,0x64,0x15,0x64,0x63,0x19,0x6b,0x6a,
+0x0a,0x64,0x0a,0x0a,0x0a,0x34,0x32,0x34,0x0a,0x63,0x16,0x15,0x64,0x02,0x1b,0x6a,
+
+0x6b,0x6c,0x63,0x15,0x15,0x0a,0x3c,0x2b,0x2b,0x24,0x06,0x0b,0x64,0x64,0x64,0x63,
+0x6d,0x63,0x15,0x15,0x15,0x0a,0x3c,0x2b,0x2b,0x2b,0x2b,0x3f,0x0b,0x64,0x64,0x63,
+0x6c,0x63,0x16,0x64,0x16,0x63,0x32,0x24,0x24,0x24,0x2b,0x2b,0x2b,0x06,0x3e,0x63,
+0x6a,0x64,0x16,0x64,0x15,0x16,0x2b,0x2b,0x2b,0x2b,0x2b,0x2b,0x2b,0x2b,0x32,0x32,
+0x6b,0x16,0x65,0x16,0x15,0x15,0x16,0x2b,0x2b,0x2b,0x24,0x2b,0x2b,0x2b,0x2b,0x2b,
+0x6c,0x16,0x64,0x16,0x15,0x64,0x15,0x16,0x16,0x2b,0x2b,0x2b,0x2b,0x2b,0x24,0x24,
+0x6b,0x15,0x63,0x63,0x63,0x16,0x16,0x64,0x15,0x16,0x16,0x2b,0x2b,0x2b,0x2b,0x2b,
+0x6b,0x63,0x63,0x63,0x16,0x64,0x15,0x15,0x64,0x64,0x15,0x16,0x16,0x15,0x16,0x16,
+0x6a,0x63,0x63,0x63,0x16,0x63,0x16,0x15,0x64,0x64,0x64,0x64,0x64,0x15,0x15,0x15,
+0x6a,0x6d,0x02,0x16,0x15,0x63,0x15,0x16,0x63,0x64,0x63,0x16,0x15,0x63,0x63,0x63,
+0x6b,0x6c,0x6b,0x63,0x63,0x63,0x64,0x64,0x63,0x64,0x63,0x63,0x64,0x63,0x0a,0x63,
+0x6b,0x6c,0x1b,0x02,0x63,0x0a,0x63,0x63,0x63,0x63,0x63,0x63,0x16,0x15,0x63,0x64,
+0x6c,0x1a,0x6c,0x6d,0x6b,0x02,0x64,0x63,0x16,0x16,0x64,0x63,0x15,0x64,0x63,0x63,
+0x6b,0x6c,0x6b,0x6d,0x1b,0x6c,0x02,0x63,0x15,0x16,0x63,0x63,0x64,0x63,0x63,0x15,
+0x6a,0x6c,0x6b,0x6c,0x6d,0x6c,0x6d,0x6b,0x02,0x64,0x0a,0x0a,0x63,0x0a,0x16,0x15,
+0x6a,0x6b,0x6b,0x6b,0x6c,0x1a,0x6b,0x1a,0x6c,0x6b,0x02,0x63,0x0a,0x63,0x64,0x64,
+
+0x0a,0x64,0x0a,0x0a,0x0c,0x3d,0x32,0x2b,0x34,0x63,0x64,0x15,0x0a,0x63,0x02,0x6b,
+0x0a,0x63,0x0a,0x06,0x3e,0x3c,0x32,0x32,0x2b,0x34,0x64,0x15,0x0a,0x0a,0x02,0x6a,
+0x0a,0x0c,0x3f,0x32,0x3e,0x34,0x2b,0x34,0x34,0x34,0x16,0x15,0x0a,0x0a,0x12,0x02,
+0x32,0x32,0x2b,0x24,0x3e,0x24,0x2b,0x34,0x34,0x16,0x15,0x64,0x0a,0x0a,0x0a,0x02,
+0x2b,0x3e,0x2b,0x2b,0x2b,0x2b,0x2b,0x34,0x16,0x15,0x64,0x63,0x0a,0x0b,0x0a,0x02,
+0x2b,0x33,0x2b,0x2b,0x2b,0x2b,0x16,0x16,0x15,0x64,0x12,0x63,0x64,0x12,0x0a,0x02,
+0x2b,0x2b,0x2b,0x2b,0x16,0x16,0x15,0x15,0x64,0x0a,0x0a,0x0a,0x64,0x0a,0x02,0x02,
+0x16,0x15,0x16,0x15,0x15,0x15,0x64,0x63,0x64,0x63,0x64,0x63,0x64,0x0a,0x02,0x02,
+0x15,0x15,0x15,0x63,0x63,0x63,0x0a,0x63,0x64,0x63,0x64,0x64,0x0a,0x02,0x02,0x19,
+0x63,0x63,0x0a,0x0a,0x0a,0x0a,0x63,0x0a,0x64,0x64,0x64,0x0a,0x02,0x02,0x02,0x6a,
+0x64,0x0a,0x63,0x15,0x63,0x63,0x15,0x0b,0x63,0x64,0x64,0x0a,0x02,0x02,0x6b,0x6b,
+0x64,0x63,0x15,0x15,0x64,0x15,0x65,0x64,0x0a,0x0a,0x0a,0x02,0x02,0x6c,0x6d,0x6c,
+0x64,0x63,0x64,0x64,0x64,0x63,0x64,0x64,0x0a,0x0a,0x02,0x02,0x02,0x6b,0x6c,0x6b,
+0x63,0x0a,0x64,0x64,0x63,0x0a,0x64,0x63,0x0a,0x02,0x02,0x6b,0x6b,0x6b,0x6c,0x6c,
+0x64,0x0a,0x64,0x64,0x63,0x0a,0x0a,0x02,0x02,0x02,0x6c,0x6a,0x6d,0x19,0x6b,0x6a,
+0x64,0x63,0x63,0x63,0x0a,0x02,0x02,0x1a,0x6c,0x6b,0x6c,0x6d,0x6c,0x6b,0x1b,0x6a,
+
+0x05,0x06,0x06,0x06,0x72,0x72,0x72,0x72,0x72,0x72,0x04,0x04,0x04,0x05,0x06,0x05,
+0x6d,0x6b,0x72,0x72,0x72,0x72,0x6c,0x72,0x6c,0x72,0x72,0x72,0x06,0x6b,0x6b,0x6b,
+0x6b,0x72,0x72,0x72,0x6c,0x6c,0x6c,0x6c,0x6c,0x6c,0x72,0x72,0x72,0x6c,0x6b,0x6c,
+0x6a,0x51,0x51,0x72,0x72,0x6c,0x6c,0x6c,0x6c,0x72,0x72,0x72,0x51,0x6c,0x6b,0x6b,
+0x51,0x51,0x72,0x72,0x6c,0x72,0x6c,0x6c,0x72,0x6c,0x72,0x72,0x72,0x51,0x6b,0x6d,
+0x51,0x72,0x51,0x72,0x72,0x72,0x6c,0x72,0x72,0x72,0x72,0x51,0x51,0x51,0x6b,0x6b,
+0x51,0x51,0x72,0x72,0x51,0x72,0x72,0x72,0x72,0x51,0x72,0x72,0x51,0x51,0x6d,0x6a,
+0x72,0x51,0x51,0x51,0x72,0x72,0x51,0x72,0x72,0x72,0x51,0x72,0x51,0x72,0x6b,0x6a,
+0x51,0x72,0x72,0x51,0x72,0x51,0x51,0x72,0x51,0x51,0x51,0x51,0x51,0x51,0x6b,0x19,
+0x6a,0x51,0x51,0x51,0x51,0x72,0x51,0x51,0x51,0x72,0x51,0x72,0x51,0x6c,0x6b,0x6a,
+0x6b,0x6c,0x51,0x51,0x51,0x72,0x51,0x51,0x51,0x51,0x72,0x51,0x6b,0x6b,0x6d,0x6c,
+0x6b,0x6b,0x03,0x03,0x03,0x51,0x51,0x63,0x51,0x03,0x03,0x03,0x03,0x6c,0x6c,0x6b,
+0x6b,0x03,0x03,0x03,0x03,0x51,0x63,0x63,0x51,0x03,0x03,0x03,0x03,0x03,0x6d,0x6b,
+0x6a,0x03,0x03,0x03,0x51,0x63,0x63,0x63,0x51,0x51,0x03,0x03,0x03,0x03,0x6c,0x6b,
+0x6a,0x6c,0x03,0x03,0x03,0x63,0x51,0x63,0x63,0x03,0x03,0x03,0x03,0x6a,0x6b,0x6b,
+0x6b,0x6b,0x6a,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x6d,0x6c,0x6b,0x6d,0x6a,
+
+0x05,0x06,0x06,0x06,0x05,0x05,0x05,0x05,0x05,0x05,0x04,0x04,0x04,0x05,0x06,0x05,
+0x6d,0x6b,0x6c,0x6b,0x6a,0x05,0x05,0x05,0x05,0x06,0x06,0x06,0x06,0x6b,0x6b,0x6b,
+0x6b,0x6b,0x6b,0x6b,0x6c,0x6b,0x6c,0x04,0x04,0x04,0x04,0x04,0x6b,0x6c,0x6b,0x6c,
+0x6a,0x6c,0x6b,0x6b,0x6b,0x6c,0x6b,0x6b,0x6c,0x6d,0x6b,0x6d,0x6d,0x6c,0x6b,0x6b,
+0x6d,0x6d,0x6d,0x6d,0x6b,0x6b,0x6a,0x6b,0x6a,0x6b,0x6c,0x6c,0x6c,0x6b,0x6b,0x6d,
+0x6b,0x6c,0x6d,0x6b,0x6b,0x6b,0x19,0x6b,0x6d,0x6c,0x6b,0x6b,0x6b,0x6b,0x6b,0x6b,
+0x6b,0x6b,0x6c,0x6c,0x6b,0x6d,0x6a,0x6b,0x6c,0x6b,0x6b,0x6c,0x6b,0x6c,0x6d,0x6a,
+0x6b,0x6b,0x6a,0x6b,0x6b,0x6c,0x6b,0x6a,0x6a,0x19,0x6b,0x6a,0x6b,0x6b,0x6b,0x6a,
+0x6a,0x6b,0x6b,0x6a,0x6b,0x62,0x19,0x6a,0x6d,0x6a,0x6a,0x6a,0x6b,0x6d,0x6b,0x19,
+0x6a,0x6d,0x6b,0x6b,0x6c,0x6a,0x6d,0x6b,0x6c,0x6b,0x6c,0x6c,0x6b,0x6c,0x6b,0x6a,
+0x6b,0x6c,0x6b,0x6b,0x6d,0x6b,0x6c,0x6b,0x6a,0x6a,0x6b,0x6d,0x6b,0x6b,0x6d,0x6c,
+0x6b,0x6b,0x6d,0x6b,0x6c,0x6d,0x6c,0x6b,0x6d,0x6b,0x6d,0x6c,0x6d,0x6c,0x6c,0x6b,
+0x6b,0x6a,0x6c,0x6b,0x6b,0x6b,0x6b,0x6b,0x6b,0x6a,0x6d,0x6b,0x6b,0x6b,0x6d,0x6b,
+0x6a,0x6d,0x6c,0x6c,0x6d,0x6c,0x6d,0x6b,0x6c,0x6a,0x6b,0x6b,0x6c,0x6b,0x6c,0x6b,
+0x6a,0x6c,0x6c,0x6c,0x6c,0x6b,0x6c,0x6b,0x6c,0x6b,0x6d,0x6b,0x6d,0x6a,0x6b,0x6b,
+0x6b,0x6b,0x6a,0x6b,0x6b,0x6b,0x6b,0x6b,0x6b,0x6a,0x6c,0x6d,0x6c,0x6b,0x6d,0x6a,
+
+0x03,0x04,0x05,0x06,0x05,0x05,0x05,0x05,0x05,0x05,0x04,0x04,0x04,0x05,0x06,0x06,
+0x6b,0x6b,0x6a,0x6a,0x1a,0x05,0x05,0x05,0x05,0x06,0x06,0x06,0x06,0x05,0x04,0x04,
+0x6b,0x6b,0x6b,0x6b,0x6c,0x6a,0x05,0x04,0x04,0x04,0x04,0x04,0x04,0x05,0x06,0x06,
+0x6b,0x6c,0x6b,0x6b,0x6b,0x1a,0x05,0x06,0x06,0x06,0x06,0x06,0x06,0x05,0x06,0x06,
+0x6d,0x6d,0x6d,0x6d,0x6b,0x6a,0x03,0x04,0x04,0x04,0x04,0x04,0x04,0x05,0x05,0x05,
+0x6b,0x6d,0x6d,0x6b,0x6b,0x6b,0x04,0x05,0x06,0x06,0x06,0x05,0x05,0x06,0x05,0x05,
+0x6c,0x6b,0x6c,0x6b,0x6c,0x6d,0x23,0x04,0x05,0x06,0x04,0x04,0x05,0x05,0x06,0x06,
+0x6b,0x6b,0x6a,0x6a,0x6b,0x6d,0x6b,0x6a,0x6a,0x05,0x05,0x05,0x06,0x05,0x05,0x05,
+0x6a,0x6b,0x6b,0x6a,0x6b,0x6a,0x6a,0x6b,0x6a,0x04,0x06,0x05,0x05,0x06,0x05,0x05,
+0x6c,0x6d,0x6a,0x6b,0x6a,0x6b,0x6d,0x6b,0x6c,0x6b,0x6a,0x1a,0x1a,0x04,0x05,0x06,
+0x6c,0x6c,0x6b,0x6b,0x6d,0x6b,0x6c,0x6b,0x6a,0x6b,0x6b,0x6d,0x6a,0x6a,0x04,0x06,
+0x6b,0x6b,0x6d,0x6b,0x6c,0x6b,0x6c,0x6c,0x6b,0x6d,0x6d,0x6d,0x6c,0x04,0x05,0x05,
+0x6b,0x6b,0x6c,0x6b,0x6b,0x6b,0x6a,0x6b,0x6b,0x6a,0x6d,0x6b,0x1a,0x04,0x06,0x06,
+0x6b,0x6d,0x6c,0x6c,0x6d,0x6b,0x6c,0x6b,0x6c,0x6a,0x6b,0x6b,0x6c,0x04,0x04,0x04,
+0x6a,0x6c,0x6b,0x6c,0x6c,0x6b,0x6c,0x6b,0x6c,0x6d,0x6d,0x6b,0x6c,0x1a,0x04,0x06,
+0x6b,0x6b,0x6a,0x6b,0x6c,0x6b,0x6d,0x6b,0x6b,0x6b,0x6c,0x6d,0x6c,0x6d,0x6a,0x19,
+
+0x6b,0x6c,0x6b,0x6a,0x6b,0x6b,0x6d,0x6b,0x6b,0x6b,0x6b,0x6c,0x6c,0x6b,0x6c,0x6b,
+0x6d,0x6c,0x6b,0x6b,0x6b,0x6b,0x6c,0x6b,0x6d,0x6b,0x6b,0x6a,0x6b,0x6b,0x6b,0x6a,
+0x6c,0x6b,0x6c,0x6b,0x6c,0x6b,0x6c,0x6d,0x6c,0x1a,0x6b,0x6d,0x6a,0x6a,0x6b,0x1b,
+0x6a,0x6b,0x6b,0x6a,0x6b,0x6c,0x6b,0x6c,0x1b,0x6d,0x6b,0x6d,0x6b,0x6d,0x6b,0x6b,
+0x6b,0x6d,0x6d,0x6d,0x6b,0x6c,0x6b,0x6b,0x6b,0x6c,0x6d,0x6c,0x6d,0x6c,0x6b,0x6d,
+0x6c,0x6c,0x6c,0x6c,0x6c,0x6b,0x6a,0x6a,0x6b,0x6c,0x6c,0x6c,0x6b,0x6b,0x6a,0x6c,
+0x6b,0x6b,0x6c,0x6c,0x6b,0x6d,0x6a,0x6b,0x6d,0x6b,0x6b,0x6c,0x6b,0x6d,0x6c,0x6a,
+0x6b,0x6b,0x6a,0x6b,0x6b,0x6c,0x6b,0x6b,0x6b,0x1a,0x6b,0x6c,0x6b,0x6b,0x6c,0x6b,
+0x6a,0x6b,0x6a,0x6a,0x6a,0x6c,0x6c,0x6b,0x6b,0x6a,0x6a,0x6a,0x6c,0x6c,0x6b,0x19,
+0x6a,0x6d,0x6b,0x6b,0x6b,0x6a,0x6a,0x6a,0x6d,0x6b,0x6c,0x6b,0x6b,0x6c,0x6c,0x6a,
+0x6b,0x6c,0x6b,0x6a,0x6b,0x6b,0x6c,0x6b,0x6b,0x6a,0x6b,0x6d,0x6b,0x6b,0x6b,0x6b,
+0x6b,0x6c,0x1b,0x6b,0x6c,0x6d,0x6c,0x6b,0x6d,0x6b,0x6c,0x6c,0x6b,0x6c,0x6d,0x6c,
+0x6c,0x1a,0x6c,0x6d,0x6b,0x6b,0x6c,0x6b,0x6c,0x6b,0x6d,0x6b,0x6c,0x6b,0x6c,0x6b,
+0x6b,0x0b,0x0b,0x0b,0x0b,0x0b,0x0b,0x0b,0x0b,0x0b,0x0b,0x0b,0x0b,0x0b,0x0b,0x0b,
+0x6a,0x65,0x65,0x65,0x65,0x64,0x64,0x65,0x65,0x65,0x65,0x65,0x64,0x65,0x64,0x65,
+0x6a,0x13,0x64,0x65,0x64,0x64,0x64,0x65,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,
+
+0x6b,0x6c,0x6b,0x6a,0x72,0x72,0x72,0x72,0x72,0x72,0x6b,0x6c,0x6c,0x6b,0x6c,0x6b,
+0x6d,0x6c,0x72,0x72,0x72,0x72,0x6c,0x72,0x6c,0x72,0x72,0x72,0x6b,0x6b,0x6b,0x6a,
+0x6c,0x72,0x72,0x72,0x6c,0x6c,0x6c,0x6c,0x6c,0x6c,0x72,0x72,0x72,0x6a,0x6b,0x1b,
+0x6a,0x51,0x51,0x72,0x72,0x6c,0x6c,0x6c,0x6c,0x72,0x72,0x72,0x51,0x6d,0x6b,0x6b,
+0x51,0x51,0x72,0x72,0x6c,0x72,0x6c,0x6c,0x72,0x6c,0x72,0x72,0x72,0x51,0x6b,0x6d,
+0x51,0x72,0x51,0x72,0x72,0x72,0x6c,0x72,0x72,0x72,0x72,0x51,0x51,0x51,0x6a,0x6c,
+0x51,0x51,0x72,0x72,0x51,0x72,0x72,0x72,0x72,0x51,0x72,0x72,0x51,0x51,0x6c,0x6a,
+0x72,0x51,0x51,0x51,0x72,0x72,0x51,0x72,0x72,0x72,0x51,0x72,0x51,0x72,0x6c,0x6b,
+0x51,0x72,0x72,0x51,0x72,0x51,0x51,0x72,0x51,0x51,0x51,0x51,0x51,0x51,0x6b,0x19,
+0x6a,0x51,0x51,0x51,0x51,0x72,0x51,0x51,0x51,0x72,0x51,0x72,0x51,0x6c,0x6c,0x6a,
+0x6b,0x6c,0x51,0x51,0x51,0x72,0x51,0x51,0x51,0x51,0x72,0x51,0x6b,0x6b,0x6b,0x6b,
+0x6b,0x6c,0x03,0x03,0x03,0x51,0x51,0x63,0x51,0x03,0x03,0x03,0x03,0x6c,0x6d,0x6c,
+0x6c,0x03,0x03,0x03,0x03,0x51,0x63,0x63,0x51,0x03,0x03,0x03,0x03,0x03,0x6c,0x6b,
+0x0b,0x0b,0x0b,0x0b,0x0b,0x0b,0x0b,0x0b,0x0b,0x0b,0x0b,0x0b,0x0b,0x0b,0x0b,0x6c,
+0x65,0x65,0x65,0x65,0x65,0x65,0x64,0x64,0x65,0x65,0x64,0x65,0x65,0x65,0x65,0x6a,
+0x64,0x64,0x64,0x65,0x64,0x64,0x66,0x66,0x65,0x64,0x65,0x64,0x65,0x64,0x64,0x6a,
+
+0x6d,0x63,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,
+0x6d,0x13,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,
+0x6b,0x6b,0x6b,0x6b,0x6c,0x62,0x6c,0x6c,0x6b,0x6a,0x6b,0x6d,0x6b,0x6c,0x6b,0x6c,
+0x6b,0x6c,0x6b,0x6b,0x6b,0x63,0x63,0x6b,0x6c,0x6d,0x6c,0x6c,0x6d,0x6c,0x6b,0x6b,
+0x6d,0x63,0x64,0x64,0x64,0x64,0x64,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,
+0x6b,0x63,0x63,0x63,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,
+0x6b,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,
+0x6b,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,
+0x6a,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,
+0x6a,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,
+0x6b,0x62,0x62,0x62,0x61,0x62,0x61,0x61,0x61,0x61,0x61,0x61,0x61,0x61,0x61,0x61,
+0x6b,0x6b,0x62,0x62,0x62,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
+0x6b,0x6a,0x64,0x62,0x62,0x62,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,
+0x6b,0x6d,0x64,0x62,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
+0x19,0x62,0x63,0x02,0x02,0x1b,0x05,0x06,0x05,0x04,0x6c,0x6b,0x6d,0x05,0x05,0x6a,
+0x04,0x04,0x04,0x04,0x04,0x04,0x05,0x05,0x06,0x06,0x06,0x05,0x04,0x04,0x04,0x04,
+
+0x64,0x64,0x65,0x65,0x64,0x64,0x64,0x65,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x6a,
+0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x6b,
+0x6b,0x6b,0x6b,0x6b,0x6c,0x6d,0x6c,0x6c,0x6b,0x6a,0x62,0x62,0x6b,0x6c,0x6b,0x6c,
+0x6b,0x6c,0x6b,0x6b,0x6b,0x6c,0x6b,0x6b,0x6c,0x6d,0x62,0x63,0x6d,0x6c,0x6b,0x6b,
+0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x64,0x64,0x63,0x6d,
+0x64,0x63,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x63,0x63,0x63,0x64,0x64,0x6b,
+0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x02,
+0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x02,
+0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x02,
+0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x02,
+0x61,0x61,0x61,0x61,0x61,0x61,0x61,0x61,0x61,0x61,0x61,0x61,0x61,0x61,0x62,0x02,
+0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x63,0x62,0x02,0x02,
+0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x62,0x62,0x63,0x62,0x02,
+0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x63,0x62,0x02,
+0x19,0x6c,0x05,0x06,0x6c,0x1b,0x05,0x06,0x05,0x04,0x6c,0x6b,0x6d,0x62,0x62,0x02,
+0x04,0x04,0x04,0x04,0x04,0x04,0x05,0x05,0x06,0x06,0x06,0x05,0x04,0x04,0x04,0x04,
+
+};
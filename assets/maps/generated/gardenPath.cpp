@@ -0,0 +1,210 @@
+// Generated File - DO NOT EDIT
+#include "maps.h"
+
+#ifndef MAPS_EXCLUDE_gardenPath
+
+const uint8_t gardenPath[] = {
+14, 11,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+0x02, 0x03, 0x03, 0x03, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x01, 0x01, 0x01, 0x01, 0x06, 0x07, 0x01, 0x00,
+0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x01, 0x01, 0x01, 0x08, 0x09, 0x01, 0x00,
+0x0a, 0x0b, 0x0b, 0x0b, 0x0c, 0x04, 0x04, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+0x00, 0x01, 0x01, 0x01, 0x01, 0x0c, 0x04, 0x04, 0x05, 0x01, 0x01, 0x01, 0x01, 0x00,
+0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0c, 0x04, 0x04, 0x05, 0x01, 0x01, 0x01, 0x00,
+0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0c, 0x04, 0x04, 0x05, 0x01, 0x0d, 0x0e,
+0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0c, 0x04, 0x04, 0x05, 0x0f, 0x10,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x04, 0x04, 0x04, 0x04
+};
+MapEnum gardenPathEnum(uint32_t x, uint32_t y){
+static const MapEnum parameters[] = {
+	Collide,
+	Collide,
+	Collide,
+	Collide,
+	Collide,
+	Collide,
+	Collide,
+	Collide,
+	Collide,
+	Collide,
+	Collide,
+	Collide,
+	Collide,
+	Collide,
+	Collide,
+	GoToEncounter,
+	GoToEncounter,
+	GoToEncounter,
+	GoToEncounter,
+	GoToEncounter,
+	GoToEncounter,
+	GoToEncounter,
+	GoToEncounter,
+	GoToEncounter,
+	GoToEncounter,
+	GoToEncounter,
+	GoToEncounter,
+	Collide,
+	Collide,
+	EMPTY,
+	EMPTY,
+	EMPTY,
+	EMPTY,
+	GoToEncounter,
+	GoToEncounter,
+	GoToEncounter,
+	GoToEncounter,
+	GoToEncounter,
+	GoToEncounter,
+	GoToEncounter,
+	GoToEncounter,
+	Collide,
+	GoToTitle,
+	EMPTY,
+	EMPTY,
+	EMPTY,
+	EMPTY,
+	EMPTY,
+	GoToEncounter,
+	GoToEncounter,
+	GoToEncounter,
+	GoToEncounter,
+	Collide,
+	Collide,
+	GoToEncounter,
+	Collide,
+	GoToTitle,
+	EMPTY,
+	EMPTY,
+	EMPTY,
+	EMPTY,
+	EMPTY,
+	EMPTY,
+	GoToEncounter,
+	GoToEncounter,
+	GoToEncounter,
+	Collide,
+	Collide,
+	GoToEncounter,
+	Collide,
+	Collide,
+	EMPTY,
+	EMPTY,
+	EMPTY,
+	EMPTY,
+	EMPTY,
+	EMPTY,
+	EMPTY,
+	GoToEncounter,
+	GoToEncounter,
+	GoToEncounter,
+	GoToEncounter,
+	GoToEncounter,
+	Collide,
+	Collide,
+	GoToEncounter,
+	GoToEncounter,
+	GoToEncounter,
+	GoToEncounter,
+	EMPTY,
+	EMPTY,
+	EMPTY,
+	EMPTY,
+	GoToEncounter,
+	GoToEncounter,
+	GoToEncounter,
+	GoToEncounter,
+	Collide,
+	Collide,
+	GoToEncounter,
+	GoToEncounter,
+	GoToEncounter,
+	GoToEncounter,
+	GoToEncounter,
+	EMPTY,
+	EMPTY,
+	EMPTY,
+	EMPTY,
+	GoToEncounter,
+	GoToEncounter,
+	GoToEncounter,
+	Collide,
+	Collide,
+	GoToEncounter,
+	GoToEncounter,
+	GoToEncounter,
+	GoToEncounter,
+	GoToEncounter,
+	GoToEncounter,
+	EMPTY,
+	EMPTY,
+	EMPTY,
+	EMPTY,
+	GoToEncounter,
+	GoToEncounter,
+	Collide,
+	Collide,
+	GoToEncounter,
+	GoToEncounter,
+	GoToEncounter,
+	GoToEncounter,
+	GoToEncounter,
+	GoToEncounter,
+	GoToEncounter,
+	EMPTY,
+	EMPTY,
+	EMPTY,
+	EMPTY,
+	Collide,
+	Collide,
+	Collide,
+	Collide,
+	Collide,
+	Collide,
+	Collide,
+	Collide,
+	Collide,
+	Collide,
+	Collide,
+	GoToTitle,
+	GoToTitle,
+	GoToTitle,
+	GoToTitle,
+	GoToTitle
+    };
+    return (x >= 14 || y >= 11) ? EMPTY : parameters[y * 14 + x];
+}
+static const uint8_t gardenPathTileChunk0_0[] = {14, 0x00, 2, 0xff, 1, 0x00, 12, 0x01, 1, 0x00, 2, 0xff, 1, 0x02, 4, 0x03, 8, 0x01, 1, 0x00, 2, 0xff, 5, 0x04, 1, 0x05, 4, 0x01, 1, 0x06, 1, 0x07, 1, 0x01, 1, 0x00, 2, 0xff, 6, 0x04, 1, 0x05, 3, 0x01, 1, 0x08, 1, 0x09, 1, 0x01, 1, 0x00, 2, 0xff, 1, 0x0a, 3, 0x0b, 1, 0x0c, 2, 0x04, 1, 0x05, 5, 0x01, 1, 0x00, 2, 0xff, 1, 0x00, 4, 0x01, 1, 0x0c, 2, 0x04, 1, 0x05, 4, 0x01, 1, 0x00, 2, 0xff, 1, 0x00, 5, 0x01, 1, 0x0c, 2, 0x04, 1, 0x05, 3, 0x01, 1, 0x00, 2, 0xff, 1, 0x00, 6, 0x01, 1, 0x0c, 2, 0x04, 1, 0x05, 1, 0x01, 1, 0x0d, 1, 0x0e, 2, 0xff, 1, 0x00, 7, 0x01, 1, 0x0c, 2, 0x04, 1, 0x05, 1, 0x0f, 1, 0x10, 2, 0xff, 9, 0x00, 1, 0x0c, 4, 0x04, 82, 0xff};
+static const uint8_t gardenPathEventChunk0_0[] = {14, Collide, 2, EMPTY, 1, Collide, 12, GoToEncounter, 1, Collide, 2, EMPTY, 1, Collide, 4, EMPTY, 8, GoToEncounter, 1, Collide, 2, EMPTY, 1, GoToTitle, 5, EMPTY, 4, GoToEncounter, 2, Collide, 1, GoToEncounter, 1, Collide, 2, EMPTY, 1, GoToTitle, 6, EMPTY, 3, GoToEncounter, 2, Collide, 1, GoToEncounter, 1, Collide, 2, EMPTY, 1, Collide, 7, EMPTY, 5, GoToEncounter, 1, Collide, 2, EMPTY, 1, Collide, 4, GoToEncounter, 4, EMPTY, 4, GoToEncounter, 1, Collide, 2, EMPTY, 1, Collide, 5, GoToEncounter, 4, EMPTY, 3, GoToEncounter, 1, Collide, 2, EMPTY, 1, Collide, 6, GoToEncounter, 4, EMPTY, 2, GoToEncounter, 1, Collide, 2, EMPTY, 1, Collide, 7, GoToEncounter, 4, EMPTY, 2, Collide, 2, EMPTY, 9, Collide, 5, GoToTitle, 82, EMPTY};
+static const uint8_t* const gardenPathTileChunks[] = {gardenPathTileChunk0_0};
+static const uint8_t* const gardenPathEventChunks[] = {gardenPathEventChunk0_0};
+const world::ChunkedMapData gardenPathChunked = {14, 11, 1, 1, gardenPathTileChunks, gardenPathEventChunks};
+const uint8_t gardenPathTileIds[] = {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10};
+static const uint8_t gardenPathEventCells[] = {
+0x55, 0x55, 0x55, 0x95, 0xaa, 0xaa, 0x6a, 0x01, 0xa8, 0xaa, 0x36, 0x00, 0xaa, 0x65, 0x03, 0x80,
+0x5a, 0x16, 0x00, 0xa0, 0x6a, 0xa9, 0x02, 0xa8, 0x96, 0xaa, 0x00, 0x6a, 0xa9, 0x2a, 0x80, 0x96,
+0xaa, 0x0a, 0x50, 0x55, 0x55, 0xfd, 0x0f
+};
+const world::EventLayerData gardenPathEvents = {14, 11, 2, gardenPathEventCells};
+static const world::TriggerRect gardenPathTriggerRects[] = {
+	{1, 1, 12, 1, GoToEncounter},
+	{5, 2, 8, 1, GoToEncounter},
+	{0, 3, 1, 2, GoToTitle},
+	{6, 3, 4, 1, GoToEncounter},
+	{12, 3, 1, 6, GoToEncounter},
+	{7, 4, 3, 1, GoToEncounter},
+	{8, 5, 4, 1, GoToEncounter},
+	{1, 6, 4, 4, GoToEncounter},
+	{9, 6, 3, 1, GoToEncounter},
+	{5, 7, 1, 3, GoToEncounter},
+	{10, 7, 2, 1, GoToEncounter},
+	{6, 8, 1, 2, GoToEncounter},
+	{11, 8, 1, 1, GoToEncounter},
+	{7, 9, 1, 1, GoToEncounter},
+	{9, 10, 5, 1, GoToTitle}
+};
+const world::TriggerIndexData gardenPathTriggers = {15, 6, gardenPathTriggerRects};
+
+#endif // MAPS_EXCLUDE_gardenPath
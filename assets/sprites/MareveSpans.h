@@ -0,0 +1,19 @@
+// Generated File - DO NOT EDIT
+
+#pragma once
+
+const uint8_t MareveSpans[] = {
+12, 12,
+0x01,0x03,0x03,0x67,0x67,0x67,
+0x02,0x02,0x01,0x67,0x04,0x04,0x0d,0x67,0x67,0x67,
+0x01,0x03,0x06,0x0d,0x67,0x0d,0x67,0x0d,0x67,
+0x01,0x03,0x07,0x67,0x0d,0x0e,0x0e,0x0e,0x0d,0x67,
+0x01,0x02,0x06,0x67,0x0d,0x67,0x43,0x0e,0x43,
+0x01,0x02,0x07,0x0d,0x67,0x0e,0x0e,0x0e,0x0e,0x67,
+0x01,0x03,0x07,0x0d,0x67,0xa4,0xa4,0xa4,0x0d,0x67,
+0x01,0x03,0x05,0x4a,0xa4,0x4a,0xa4,0x4a,
+0x01,0x03,0x06,0x52,0x4a,0xa4,0x4a,0xa4,0x52,
+0x01,0x02,0x08,0x52,0x0e,0x52,0xa2,0xa2,0xa2,0x0e,0x52,
+0x01,0x03,0x06,0x52,0xa1,0xa1,0xa1,0xa1,0x52,
+0x02,0x04,0x02,0xa1,0xa1,0x07,0x02,0xa1,0xa1
+};
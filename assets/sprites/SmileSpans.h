@@ -0,0 +1,39 @@
+// Generated File - DO NOT EDIT
+
+#pragma once
+
+const uint8_t SmileSpans[] = {
+32, 32,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x01,0x0d,0x07,0xe3,0xe3,0xe3,0xe3,0xe3,0xe3,0xe3,
+0x01,0x0a,0x0d,0xe3,0xe3,0xe3,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xe3,0xe3,0xe3,
+0x01,0x09,0x0f,0xe3,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xe3,
+0x01,0x08,0x11,0xe3,0xbe,0xbe,0xa8,0xa8,0xa8,0xa8,0xbe,0xbe,0xbe,0xa8,0xa8,0xa8,0xa8,0xbe,0xbe,0xe3,
+0x01,0x07,0x13,0xe3,0xbe,0xbe,0xa8,0x07,0xe3,0xe3,0x07,0xbe,0xbe,0xbe,0x07,0xe3,0xe3,0x07,0xa8,0xbe,0xbe,0xe3,
+0x01,0x06,0x15,0xe3,0xbe,0xbe,0xbe,0xa8,0x07,0xe3,0xe3,0x07,0xbe,0xbe,0xbe,0x07,0xe3,0xe3,0x07,0xa8,0xbe,0xbe,0xbe,0xe3,
+0x01,0x06,0x15,0xe3,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xe3,
+0x01,0x05,0x17,0xe3,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xe3,
+0x01,0x05,0x17,0xe3,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xa8,0xbe,0xbe,0xbe,0xa8,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xe3,
+0x01,0x05,0x17,0xe3,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xa8,0xbe,0xbe,0xbe,0xa8,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xe3,
+0x01,0x05,0x17,0xe3,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xa8,0xa8,0xa8,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xe3,
+0x01,0x05,0x17,0xe3,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xe3,
+0x01,0x05,0x17,0xe3,0xbe,0xbe,0xbe,0xbe,0xe3,0xe3,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xe3,0xe3,0xbe,0xbe,0xbe,0xe3,
+0x01,0x06,0x15,0xe3,0xbe,0xbe,0xbe,0xbe,0xe3,0xe3,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xe3,0xe3,0xbe,0xbe,0xbe,0xe3,
+0x01,0x06,0x15,0xe3,0xbe,0xbe,0xbe,0xbe,0xbe,0xe3,0xe3,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xe3,0xe3,0xbe,0xbe,0xbe,0xbe,0xe3,
+0x01,0x07,0x13,0xe3,0xbe,0xbe,0xbe,0xbe,0xbe,0xe3,0xe3,0xe3,0xe3,0xe3,0xe3,0xe3,0xe3,0xbe,0xbe,0xbe,0xbe,0xe3,
+0x01,0x08,0x11,0xe3,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xe3,0xe3,0xe3,0xe3,0xbe,0xbe,0xbe,0xbe,0xbe,0xe3,
+0x01,0x09,0x0f,0xe3,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xe3,
+0x01,0x0a,0x0d,0xe3,0xe3,0xe3,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xe3,0xe3,0xe3,
+0x01,0x0d,0x07,0xe3,0xe3,0xe3,0xe3,0xe3,0xe3,0xe3,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00
+};
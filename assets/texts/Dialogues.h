@@ -0,0 +1,30 @@
+// Generated File - DO NOT EDIT
+// Compressed from Dialogues.txt by scripts/StringTableCompiler.cpp.
+#pragma once
+
+#include <cstdint>
+
+#include "ptui/StringTable.hpp"
+
+static_assert(ptui::StringTable::maxDepth >= 2, "Pairs nest deeper than StringReader's stack");
+
+// The strings' ids, e.g. ptui::StringReader(Dialogues, DialoguesId::greeting).
+struct DialoguesId
+{
+    enum : uint16_t
+    {
+        greeting, // "Hello my good chap! Are we ready for the Punk Ja"...
+        villainMonologue, // "Life... dreams... hope...\n    \n\nWhere do they"...
+        count
+    };
+};
+
+inline constexpr char DialoguesSymbols[] = {10,32,33,39,46,63,65,72,73,74,76,80,83,87,97,99,100,101,102,103,104,105,107,108,109,110,111,112,114,115,116,117,119,121,};
+inline constexpr uint8_t DialoguesPairs[][2] = {{1,1},{17,1},{1,30},{20,17},{4,4},{33,1},{38,4},{17,14},{23,23},{28,35},{34,34},{36,37},};
+inline constexpr uint16_t DialoguesOffsets[] = {0,46,145,};
+inline constexpr uint8_t DialoguesData[] = {
+7,17,42,26,1,24,39,19,26,26,16,1,15,20,14,27,2,1,6,43,32,35,28,41,16,39,18,26,28,36,20,35,11,31,25,22,1,9,14,24,1,33,17,30,5,2,
+10,21,18,17,40,1,16,28,41,24,29,40,1,20,26,27,17,40,0,44,0,0,13,37,43,16,26,45,39,15,26,24,35,18,28,26,24,5,0,6,25,16,1,32,37,43,16,26,45,39,19,26,5,0,44,1,0,0,12,31,15,20,1,24,41,25,21,25,19,23,17,29,29,36,20,21,25,19,29,40,0,8,3,42,1,16,17,29,30,28,26,33,45,24,1,14,42,2,44,
+0};
+
+inline constexpr ptui::StringTable Dialogues{2, 34, DialoguesSymbols, DialoguesPairs, DialoguesOffsets, DialoguesData};
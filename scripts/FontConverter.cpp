@@ -0,0 +1,490 @@
+// Rasterises a BDF bitmap font into a terminal tileset header, in the format ptui's setTilesetImage() expects:
+// a tile of width x height 8bpp pixels per glyph, ink pixels on a background colour.
+// TTF/OTF fonts can be converted to BDF first, e.g. with otf2bdf or FontForge, at the target pixel size.
+//
+// Build:
+//     g++ -std=c++17 -O2 -o fontconv scripts/FontConverter.cpp
+// Run from the project's root:
+//     ./fontconv --font fonts/terminal.bdf --charset assets/texts.txt --packed
+//
+// By default, tiles are indexed by their character's code, as the terminal prints ASCII: the 128 ASCII tiles come first,
+// then the charset's other characters. With --packed, only the charset's characters get a tile, space first, from tile 1.
+// Either way, characters not printed through their own code (every one with --packed) are found through a perfect hash,
+// emitted as a ptui::GlyphRemap for the UTF-8 printing path (ptui/UTF8.hpp) to look tiles up in O(1), even at compile time.
+// Packed tilesets leave tiles 0 and '\n' blank and unmapped, as printString() and printText() take them for the string's end
+// and a new line.
+
+#if !defined(POKITTO) && !defined(DESKTOP)
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+namespace
+{
+    namespace fs = std::filesystem;
+
+    // Tile indices are a byte.
+    constexpr unsigned maxTileCount = 256;
+    constexpr unsigned asciiCount = 128;
+    // Perfect hash slots without a code point hold one no text can contain.
+    constexpr std::uint32_t emptySlot = 0xFFFFFFFF;
+    // The tiles of packed tilesets which printString() reads as control codes, left blank.
+    constexpr std::uint32_t controlTile = 0xFFFFFFFE;
+
+
+    struct Glyph
+    {
+        int width = 0;
+        int height = 0;
+        int offsetX = 0;
+        int offsetY = 0;
+        // Rows of bits, MSB first, as in the BDF.
+        std::vector<std::vector<bool>> rows;
+    };
+
+    struct Font
+    {
+        int ascent = 0;
+        std::map<std::uint32_t, Glyph> glyphs;
+    };
+
+    struct PerfectHash
+    {
+        std::uint32_t multiplier = 0;
+        unsigned bits = 0;
+        std::vector<std::uint32_t> codePoints;
+        std::vector<std::uint8_t> tiles;
+    };
+
+    struct Options
+    {
+        fs::path fontPath;
+        fs::path charsetPath;
+        fs::path outputPath = fs::path("assets") / "tilesets" / "TerminalTileSet.h";
+        std::string name = "TerminalTileSet";
+        unsigned width = 6;
+        unsigned height = 6;
+        std::uint8_t ink = 6;
+        std::uint8_t background = 1;
+        bool packed = false;
+    };
+
+
+    bool readFile(const fs::path& path, std::string& content)
+    {
+        std::ifstream stream(path, std::ios::binary);
+        std::ostringstream buffer;
+
+        if (!stream)
+            return false;
+        buffer << stream.rdbuf();
+        content = buffer.str();
+        return true;
+    }
+
+    // Returns whether the file had to be written, which leaves an up-to-date header and its dependents untouched.
+    bool writeIfChanged(const fs::path& path, const std::string& content, bool& failed)
+    {
+        std::string previous;
+
+        if (readFile(path, previous) && (previous == content))
+            return false;
+
+        std::ofstream stream(path, std::ios::binary);
+
+        stream << content;
+        if (!stream)
+        {
+            std::fprintf(stderr, "Can't write %s\n", path.string().c_str());
+            failed = true;
+        }
+        return true;
+    }
+
+    std::string hexByte(std::uint8_t value)
+    {
+        char buffer[5];
+
+        std::snprintf(buffer, sizeof(buffer), "0x%02X", value);
+        return buffer;
+    }
+
+    std::string hexCodePoint(std::uint32_t codePoint)
+    {
+        char buffer[11];
+
+        std::snprintf(buffer, sizeof(buffer), "0x%04X", unsigned(codePoint));
+        return buffer;
+    }
+
+    // Decodes UTF-8, skipping malformed sequences.
+    std::vector<std::uint32_t> decodeUTF8(const std::string& text)
+    {
+        std::vector<std::uint32_t> codePoints;
+
+        for (std::size_t i = 0; i < text.size();)
+        {
+            unsigned char lead = text[i];
+            unsigned length = (lead < 0x80) ? 1 : ((lead >> 5) == 0x6) ? 2 : ((lead >> 4) == 0xE) ? 3 : ((lead >> 3) == 0x1E) ? 4 : 0;
+            std::uint32_t codePoint = (length == 1) ? lead : (length == 2) ? (lead & 0x1F) : (length == 3) ? (lead & 0x0F) : (lead & 0x07);
+            bool valid = (length > 0) && (i + length <= text.size());
+
+            for (unsigned j = 1; valid && (j < length); j++)
+            {
+                unsigned char continuation = text[i + j];
+
+                valid = (continuation >> 6) == 0x2;
+                codePoint = (codePoint << 6) | (continuation & 0x3F);
+            }
+            if (valid)
+                codePoints.push_back(codePoint);
+            i += valid ? length : 1;
+        }
+        return codePoints;
+    }
+
+
+    // BDF.
+
+    bool parseBDF(const std::string& source, Font& font)
+    {
+        std::istringstream lines(source);
+        std::string line;
+        Glyph glyph;
+        long encoding = -1;
+        int boundingHeight = 0;
+        int boundingOffsetY = 0;
+        int remainingRows = -1;
+
+        while (std::getline(lines, line))
+        {
+            if (!line.empty() && (line.back() == '\r'))
+                line.pop_back();
+
+            std::istringstream words(line);
+            std::string keyword;
+
+            words >> keyword;
+            if (remainingRows > 0)
+            {
+                unsigned long bits = std::stoul(keyword, nullptr, 16);
+                unsigned bitCount = keyword.size() * 4;
+                std::vector<bool> row(glyph.width);
+
+                for (int x = 0; x < glyph.width; x++)
+                    row[x] = (bits >> (bitCount - 1 - x)) & 1;
+                glyph.rows.push_back(row);
+                remainingRows--;
+            }
+            else if (keyword == "FONTBOUNDINGBOX")
+            {
+                int width, offsetX;
+
+                words >> width >> boundingHeight >> offsetX >> boundingOffsetY;
+            }
+            else if (keyword == "FONT_ASCENT")
+                words >> font.ascent;
+            else if (keyword == "STARTCHAR")
+            {
+                glyph = Glyph();
+                encoding = -1;
+            }
+            else if (keyword == "ENCODING")
+                words >> encoding;
+            else if (keyword == "BBX")
+                words >> glyph.width >> glyph.height >> glyph.offsetX >> glyph.offsetY;
+            else if (keyword == "BITMAP")
+                remainingRows = glyph.height;
+            else if (keyword == "ENDCHAR")
+            {
+                if (remainingRows != 0)
+                    return false;
+                // Glyphs without a standard encoding can't be printed.
+                if (encoding >= 0)
+                    font.glyphs[encoding] = glyph;
+                remainingRows = -1;
+            }
+        }
+        if (font.ascent == 0)
+            font.ascent = boundingHeight + boundingOffsetY;
+        return !font.glyphs.empty();
+    }
+
+    // Draws the glyph into a tile, on the baseline at the font's ascent. Returns false if it had to be clipped.
+    bool rasterise(const Font& font, const Glyph& glyph, const Options& options, std::vector<std::uint8_t>& tile)
+    {
+        bool clipped = false;
+
+        tile.assign(options.width * options.height, options.background);
+        for (int row = 0; row < glyph.height; row++)
+            for (int column = 0; column < glyph.width; column++)
+            {
+                if (!glyph.rows[row][column])
+                    continue;
+
+                int x = glyph.offsetX + column;
+                int y = font.ascent - (glyph.offsetY + glyph.height) + row;
+
+                if ((x < 0) || (y < 0) || (x >= int(options.width)) || (y >= int(options.height)))
+                    clipped = true;
+                else
+                    tile[y * options.width + x] = options.ink;
+            }
+        return !clipped;
+    }
+
+
+    // Finds a multiplier for which (codePoint * multiplier) >> (32 - bits) gives each code point its own slot,
+    // growing the table until one is found. The candidates come from a fixed sequence, so the output is reproducible.
+    bool buildPerfectHash(const std::vector<std::pair<std::uint32_t, unsigned>>& remaps, std::uint8_t missingTile, PerfectHash& hash)
+    {
+        constexpr unsigned maxBits = 12;
+        constexpr unsigned attemptsPerSize = 100000;
+        std::uint32_t state = 0x9E3779B9;
+        unsigned bits = 1;
+
+        if (remaps.empty())
+            return true;
+        while ((1u << bits) < remaps.size())
+            bits++;
+        for (; bits <= maxBits; bits++)
+            for (unsigned attempt = 0; attempt < attemptsPerSize; attempt++)
+            {
+                // Xorshift, and odd multipliers only.
+                state ^= state << 13;
+                state ^= state >> 17;
+                state ^= state << 5;
+
+                std::uint32_t multiplier = state | 1;
+                std::vector<std::uint32_t> codePoints(1u << bits, emptySlot);
+                std::vector<std::uint8_t> tiles(1u << bits, missingTile);
+                bool collided = false;
+
+                for (const auto& remap : remaps)
+                {
+                    std::uint32_t slot = std::uint32_t(remap.first * multiplier) >> (32 - bits);
+
+                    if (codePoints[slot] != emptySlot)
+                    {
+                        collided = true;
+                        break;
+                    }
+                    codePoints[slot] = remap.first;
+                    tiles[slot] = remap.second;
+                }
+                if (!collided)
+                {
+                    hash = {multiplier, bits, codePoints, tiles};
+                    return true;
+                }
+            }
+        return false;
+    }
+
+    void usage()
+    {
+        std::fprintf(stderr,
+                     "Usage: fontconv --font <font.bdf> [--charset <text file>] [--packed] [--output <header.h>] [--name <symbol>]\n"
+                     "                [--size <width>x<height>] [--ink <color>] [--background <color>]\n"
+                     "  --font        The BDF font, at the tile's pixel size.\n"
+                     "  --charset     A UTF-8 text whose characters get a tile, e.g. every string of the game (default: ASCII).\n"
+                     "  --packed      Only gives a tile to the charset's characters, rather than to every ASCII code first.\n"
+                     "  --output      The generated header (default: assets/tilesets/TerminalTileSet.h).\n"
+                     "  --name        The tileset's symbol, which prefixes its ptui::GlyphRemap's (default: TerminalTileSet).\n"
+                     "  --size        The tiles' size in pixels (default: 6x6).\n"
+                     "  --ink         The glyphs' color index (default: 6).\n"
+                     "  --background  The tiles' background color index (default: 1).\n");
+    }
+}
+
+
+int main(int argc, char** argv)
+{
+    Options options;
+
+    for (int i = 1; i < argc; i++)
+    {
+        std::string argument = argv[i];
+        bool hasValue = i + 1 < argc;
+
+        if ((argument == "--font") && hasValue)
+            options.fontPath = argv[++i];
+        else if ((argument == "--charset") && hasValue)
+            options.charsetPath = argv[++i];
+        else if ((argument == "--output") && hasValue)
+            options.outputPath = argv[++i];
+        else if ((argument == "--name") && hasValue)
+            options.name = argv[++i];
+        else if ((argument == "--size") && hasValue)
+            std::sscanf(argv[++i], "%ux%u", &options.width, &options.height);
+        else if ((argument == "--ink") && hasValue)
+            options.ink = std::stoul(argv[++i]);
+        else if ((argument == "--background") && hasValue)
+            options.background = std::stoul(argv[++i]);
+        else if (argument == "--packed")
+            options.packed = true;
+        else
+        {
+            usage();
+            return 1;
+        }
+    }
+    if (options.fontPath.empty() || (options.width == 0) || (options.height == 0))
+    {
+        usage();
+        return 1;
+    }
+
+    std::string source;
+    Font font;
+
+    if (!readFile(options.fontPath, source) || !parseBDF(source, font))
+    {
+        std::fprintf(stderr, "Can't parse %s\n", options.fontPath.string().c_str());
+        return 1;
+    }
+
+    // The characters needing a tile.
+    std::set<std::uint32_t> charset;
+
+    if (!options.charsetPath.empty())
+    {
+        std::string text;
+
+        if (!readFile(options.charsetPath, text))
+        {
+            std::fprintf(stderr, "Can't read %s\n", options.charsetPath.string().c_str());
+            return 1;
+        }
+        for (auto codePoint : decodeUTF8(text))
+            if (codePoint >= 0x20)
+                charset.insert(codePoint);
+    }
+    else
+        for (std::uint32_t codePoint = 0x20; codePoint < 0x7F; codePoint++)
+            charset.insert(codePoint);
+    charset.erase(' ');
+
+    std::vector<std::uint32_t> tileCodePoints;
+
+    if (options.packed)
+    {
+        tileCodePoints.push_back(controlTile);
+        tileCodePoints.push_back(' ');
+    }
+    else
+        for (std::uint32_t codePoint = 0; codePoint < asciiCount; codePoint++)
+            tileCodePoints.push_back(codePoint);
+    for (auto codePoint : charset)
+        if (options.packed || (codePoint >= asciiCount))
+        {
+            if (options.packed && (tileCodePoints.size() == '\n'))
+                tileCodePoints.push_back(controlTile);
+            tileCodePoints.push_back(codePoint);
+        }
+    if (tileCodePoints.size() > maxTileCount)
+    {
+        std::fprintf(stderr, "%u tiles, only %u fit in a tile byte\n", unsigned(tileCodePoints.size()), maxTileCount);
+        return 1;
+    }
+
+    std::string tiles;
+    std::vector<std::pair<std::uint32_t, unsigned>> remaps;
+    unsigned missing = 0;
+
+    for (unsigned index = 0; index < tileCodePoints.size(); index++)
+    {
+        std::uint32_t codePoint = tileCodePoints[index];
+        auto glyph = font.glyphs.find(codePoint);
+        std::vector<std::uint8_t> tile(options.width * options.height, options.background);
+
+        if (glyph != font.glyphs.end())
+        {
+            if (!rasterise(font, glyph->second, options, tile))
+                std::fprintf(stderr, "Warning: U+%04X doesn't fit in %ux%u and was clipped\n", unsigned(codePoint), options.width, options.height);
+        }
+        else if (charset.count(codePoint) > 0)
+        {
+            std::fprintf(stderr, "Warning: U+%04X isn't in the font, its tile is blank\n", unsigned(codePoint));
+            missing++;
+        }
+        if ((codePoint != controlTile) && (options.packed || (codePoint >= asciiCount)))
+            remaps.emplace_back(codePoint, index);
+        for (unsigned y = 0; y < options.height; y++)
+        {
+            for (unsigned x = 0; x < options.width; x++)
+                tiles += hexByte(tile[y * options.width + x]) + ",";
+            tiles += "\n";
+        }
+        tiles += "\n";
+    }
+
+    // Missing characters show as '?', or as blanks if even that is missing. Space is never tile 0 or '\n', the control codes.
+    auto missingGlyph = std::find(tileCodePoints.begin(), tileCodePoints.end(), '?');
+
+    if (missingGlyph == tileCodePoints.end())
+        missingGlyph = std::find(tileCodePoints.begin(), tileCodePoints.end(), ' ');
+
+    std::uint8_t missingTile = missingGlyph - tileCodePoints.begin();
+    PerfectHash hash;
+
+    if (!buildPerfectHash(remaps, missingTile, hash))
+    {
+        std::fprintf(stderr, "Can't find a perfect hash for %u characters\n", unsigned(remaps.size()));
+        return 1;
+    }
+
+    std::string header =
+        "// Generated File - DO NOT EDIT\n"
+        "// Rasterised from " + options.fontPath.filename().string() + " by scripts/FontConverter.cpp.\n"
+        "#pragma once\n"
+        "\n"
+        "#include <cstdint>\n"
+        "\n"
+        "#include \"ptui/GlyphRemap.hpp\"\n"
+        "\n"
+        "// " + std::to_string(tileCodePoints.size()) + " tiles of " + std::to_string(options.width) + "x" + std::to_string(options.height) + " pixels.\n"
+        "const uint8_t " + options.name + "[] = {\n" + tiles + "};\n"
+        "\n"
+        "\n"
+        "// Where the characters are, see ptui::GlyphRemap.\n";
+    if (hash.bits == 0)
+        header += "inline constexpr ptui::GlyphRemap " + options.name + "Glyphs = ptui::asciiGlyphs;\n";
+    else
+    {
+        std::string codePoints, tiles;
+
+        for (std::size_t slot = 0; slot < hash.codePoints.size(); slot++)
+        {
+            codePoints += hexCodePoint(hash.codePoints[slot]) + ",";
+            tiles += std::to_string(hash.tiles[slot]) + ",";
+        }
+        header +=
+            "inline constexpr uint32_t " + options.name + "GlyphCodePoints[] = {" + codePoints + "};\n"
+            "inline constexpr uint8_t " + options.name + "GlyphTiles[] = {" + tiles + "};\n"
+            "inline constexpr ptui::GlyphRemap " + options.name + "Glyphs{" + hexCodePoint(hash.multiplier) + ", " + std::to_string(hash.bits) + ", "
+            + (options.packed ? "false" : "true") + ", " + std::to_string(missingTile) + ", "
+            + options.name + "GlyphCodePoints, " + options.name + "GlyphTiles};\n";
+    }
+
+    bool failed = false;
+    bool written = writeIfChanged(options.outputPath, header, failed);
+
+    if (failed)
+        return 1;
+    std::printf("%u tiles, %u remapped, %u missing from the font, %s.\n", unsigned(tileCodePoints.size()), unsigned(remaps.size()), missing,
+                written ? "updated" : "unchanged");
+    return 0;
+}
+
+
+#endif // !defined(POKITTO) && !defined(DESKTOP)
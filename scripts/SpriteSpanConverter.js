@@ -0,0 +1,54 @@
+//!MENU-ENTRY:Convert Sprites to Spans
+//!MENU-SHORTCUT:C-S-t
+
+// This script looks in the "sprites" folder and converts each 8bpp sprite header into a span-encoded one, <Name>Spans.h.
+// Each row is stored as a span count followed by (start, length, pixels...) for each run of opaque pixels,
+// so gfx::SpriteBatch can copy them without testing for transparency.
+// Run it after the sprites' PNGs have been converted.
+
+let spritesFolderPath = `assets${path.sep}sprites`;
+
+dir(spritesFolderPath)
+    .filter( file=>/\.h$/i.test(file) && !/Spans\.h$/i.test(file) )
+    .forEach( file=>{
+        let name = file.replace(/\..*/,"");
+        let source = read(`${spritesFolderPath}${path.sep}${file}`);
+        let body = source.match(/\{([\s\S]*)\}/);
+        if( !body ) return;
+        
+        let bytes = body[1].split(/\s*,\s*/).filter(x=>x.trim().length).map(x=>parseInt(x));
+        let [width, height] = bytes;
+        let pixels = bytes.slice(2);
+        let rows = [];
+        
+        for( let y=0; y<height; ++y ){
+            let row = pixels.slice(y * width, (y + 1) * width);
+            let spans = [];
+            for( let x=0; x<width; ){
+                if( !row[x] ){
+                    ++x;
+                    continue;
+                }
+                let start = x;
+                while( x < width && row[x] )
+                    ++x;
+                spans.push([start, x - start, ...row.slice(start, x)]);
+            }
+            rows.push([spans.length, ...spans.flat()]);
+        }
+        
+        let acc = `// Generated File - DO NOT EDIT
+
+#pragma once
+
+const uint8_t ${name}Spans[] = {
+${width}, ${height},
+`;
+        acc += rows.map(row=>row.map(b=>"0x"+b.toString(16).padStart(2, "0")).join(",")).join(",\n");
+        acc += `\n};\n`;
+        
+        write(`${spritesFolderPath}${path.sep}${name}Spans.h`, acc);
+        log(`${name}: ${pixels.length + 2} -> ${rows.flat().length + 2} bytes`);
+    });
+
+log("Conversion complete!");
@@ -0,0 +1,401 @@
+// Compresses the game's texts into ptui::StringTable headers, decoded a character at a time as they're printed.
+// Each text file becomes a header next to it, named after it, e.g. assets/texts/Dialogues.txt into assets/texts/Dialogues.h.
+//
+// Build:
+//     g++ -std=c++17 -O2 -o strtab scripts/StringTableCompiler.cpp
+// Run from the project's root:
+//     ./strtab assets/texts/*.txt
+//
+// Text files hold a string per line, as "name: text", where names are identifiers and become the strings' ids.
+// \n, \" and \\ are escapes, and texts can be quoted to keep their leading and trailing spaces. Empty lines and lines
+// starting with # are skipped. Texts are kept as UTF-8 bytes, mapped to tiles through the tileset's GlyphRemap as
+// they're printed.
+//
+// The compression is byte pair encoding: the bytes unused by the texts stand for the most frequent pairs of codes,
+// again and again, so common words end up as a single byte. Decoding is a table lookup per code and needs no RAM but
+// the reader's small stack, which bounds how deep pairs nest.
+
+#if !defined(POKITTO) && !defined(DESKTOP)
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+namespace
+{
+    namespace fs = std::filesystem;
+
+    constexpr unsigned codeCount = 256;
+    // Must match ptui::StringTable::maxDepth, which the generated headers check.
+    constexpr unsigned maxDepth = 12;
+    // Offsets are 16 bits.
+    constexpr std::size_t maxDataSize = 0x10000;
+    // A pair takes 2 bytes of the table, so it must replace at least 3 to save any.
+    constexpr unsigned minPairCount = 3;
+
+
+    struct Entry
+    {
+        std::string name;
+        std::string text;
+    };
+
+    struct Compressed
+    {
+        std::vector<std::uint8_t> symbols;
+        std::vector<std::pair<std::uint8_t, std::uint8_t>> pairs;
+        std::vector<std::vector<std::uint8_t>> strings;
+        unsigned depth = 0;
+    };
+
+
+    bool readFile(const fs::path& path, std::string& content)
+    {
+        std::ifstream stream(path, std::ios::binary);
+        std::ostringstream buffer;
+
+        if (!stream)
+            return false;
+        buffer << stream.rdbuf();
+        content = buffer.str();
+        return true;
+    }
+
+    // Returns whether the file had to be written, which leaves an up-to-date header and its dependents untouched.
+    bool writeIfChanged(const fs::path& path, const std::string& content, bool& failed)
+    {
+        std::string previous;
+
+        if (readFile(path, previous) && (previous == content))
+            return false;
+
+        std::ofstream stream(path, std::ios::binary);
+
+        stream << content;
+        if (!stream)
+        {
+            std::fprintf(stderr, "Can't write %s\n", path.string().c_str());
+            failed = true;
+        }
+        return true;
+    }
+
+    bool isIdentifier(const std::string& name)
+    {
+        if (name.empty() || std::isdigit(static_cast<unsigned char>(name[0])))
+            return false;
+        for (char c : name)
+            if (!std::isalnum(static_cast<unsigned char>(c)) && (c != '_'))
+                return false;
+        return true;
+    }
+
+    // The text for a generated comment: escaped, on a single line, and shortened.
+    std::string preview(const std::string& text)
+    {
+        constexpr std::size_t maxLength = 48;
+        std::string escaped;
+
+        for (std::size_t i = 0; (i < text.size()) && (escaped.size() < maxLength); i++)
+            if (text[i] == '\n')
+                escaped += "\\n";
+            else if (text[i] == '\\')
+                escaped += "\\\\";
+            else if (static_cast<unsigned char>(text[i]) < 0x20)
+                escaped += ' ';
+            else
+                escaped += text[i];
+        return "\"" + escaped + ((escaped.size() < maxLength) ? "\"" : "\"...");
+    }
+
+
+    // Parsing.
+
+    bool parseTexts(const fs::path& path, const std::string& source, std::vector<Entry>& entries)
+    {
+        std::istringstream lines(source);
+        std::string line;
+        std::set<std::string> names;
+        unsigned lineNumber = 0;
+
+        while (std::getline(lines, line))
+        {
+            lineNumber++;
+            if (!line.empty() && (line.back() == '\r'))
+                line.pop_back();
+            if (line.empty() || (line[0] == '#'))
+                continue;
+
+            std::size_t colon = line.find(':');
+            Entry entry;
+
+            if (colon != std::string::npos)
+                entry.name = line.substr(0, colon);
+            if (!isIdentifier(entry.name) || !names.insert(entry.name).second)
+            {
+                std::fprintf(stderr, "%s:%u: expected \"name: text\", with a new identifier as the name\n", path.string().c_str(), lineNumber);
+                return false;
+            }
+
+            std::size_t begin = line.find_first_not_of(" \t", colon + 1);
+            std::string value = (begin != std::string::npos) ? line.substr(begin) : "";
+            bool quoted = (value.size() >= 2) && (value.front() == '"') && (value.back() == '"');
+
+            if (quoted)
+                value = value.substr(1, value.size() - 2);
+            for (std::size_t i = 0; i < value.size(); i++)
+            {
+                if ((value[i] != '\\') || (i + 1 == value.size()))
+                {
+                    entry.text += value[i];
+                    continue;
+                }
+                switch (value[++i])
+                {
+                case 'n':
+                    entry.text += '\n';
+                    break;
+
+                case '"':
+                case '\\':
+                    entry.text += value[i];
+                    break;
+
+                default:
+                    std::fprintf(stderr, "%s:%u: unknown escape \\%c\n", path.string().c_str(), lineNumber, value[i]);
+                    return false;
+                }
+            }
+            if (entry.text.find('\0') != std::string::npos)
+            {
+                std::fprintf(stderr, "%s:%u: texts can't hold 0 bytes\n", path.string().c_str(), lineNumber);
+                return false;
+            }
+            entries.push_back(entry);
+        }
+        return true;
+    }
+
+
+    // Compression.
+
+    // Replaces the most frequent pair of codes with a new code, until there's no code left or no pair worth it.
+    // Pairs are kept within strings, and those nesting deeper than a reader's stack are skipped.
+    void compress(const std::vector<Entry>& entries, Compressed& compressed)
+    {
+        std::vector<int> symbolCodes(codeCount, -1);
+
+        for (const auto& entry : entries)
+            for (unsigned char c : entry.text)
+                symbolCodes[c] = 0;
+        for (unsigned c = 0; c < codeCount; c++)
+            if (symbolCodes[c] == 0)
+            {
+                symbolCodes[c] = compressed.symbols.size();
+                compressed.symbols.push_back(c);
+            }
+        for (const auto& entry : entries)
+        {
+            std::vector<std::uint8_t> codes;
+
+            for (unsigned char c : entry.text)
+                codes.push_back(symbolCodes[c]);
+            compressed.strings.push_back(codes);
+        }
+
+        // The reader's stack size needed to decode each code.
+        std::vector<unsigned> depths(compressed.symbols.size(), 0);
+
+        for (unsigned code = compressed.symbols.size(); code < codeCount; code++)
+        {
+            std::vector<unsigned> counts(codeCount * codeCount, 0);
+
+            for (const auto& codes : compressed.strings)
+                for (std::size_t i = 0; i + 1 < codes.size(); i++)
+                {
+                    counts[codes[i] * codeCount + codes[i + 1]]++;
+                    // Runs of a code only hold half as many pairs.
+                    if ((i + 2 < codes.size()) && (codes[i] == codes[i + 1]) && (codes[i + 1] == codes[i + 2]))
+                        i++;
+                }
+
+            unsigned best = 0;
+            unsigned bestCount = 0;
+            unsigned bestDepth = 0;
+
+            for (unsigned pair = 0; pair < counts.size(); pair++)
+            {
+                if (counts[pair] <= bestCount)
+                    continue;
+
+                // The right side waits on the stack while the left one is decoded.
+                unsigned depth = std::max(depths[pair / codeCount] + 1, depths[pair % codeCount]);
+
+                if (depth <= maxDepth)
+                {
+                    best = pair;
+                    bestCount = counts[pair];
+                    bestDepth = depth;
+                }
+            }
+            if (bestCount < minPairCount)
+                break;
+            compressed.pairs.emplace_back(best / codeCount, best % codeCount);
+            depths.push_back(bestDepth);
+            compressed.depth = std::max(compressed.depth, bestDepth);
+            for (auto& codes : compressed.strings)
+            {
+                std::vector<std::uint8_t> replaced;
+
+                for (std::size_t i = 0; i < codes.size(); i++)
+                    if ((i + 1 < codes.size()) && (codes[i] == compressed.pairs.back().first) && (codes[i + 1] == compressed.pairs.back().second))
+                    {
+                        replaced.push_back(code);
+                        i++;
+                    }
+                    else
+                        replaced.push_back(codes[i]);
+                codes = replaced;
+            }
+        }
+    }
+
+
+    // Writing.
+
+    std::string generateHeader(const fs::path& textPath, const std::string& name, const std::vector<Entry>& entries, const Compressed& compressed)
+    {
+        std::string ids, symbols, pairs, offsets, data;
+        std::size_t offset = 0;
+
+        for (std::size_t i = 0; i < entries.size(); i++)
+            ids += "        " + entries[i].name + ", // " + preview(entries[i].text) + "\n";
+        for (auto symbol : compressed.symbols)
+            symbols += std::to_string(symbol) + ",";
+        for (const auto& pair : compressed.pairs)
+            pairs += "{" + std::to_string(pair.first) + "," + std::to_string(pair.second) + "},";
+        for (const auto& codes : compressed.strings)
+        {
+            offsets += std::to_string(offset) + ",";
+            for (auto code : codes)
+                data += std::to_string(code) + ",";
+            data += "\n";
+            offset += codes.size();
+        }
+        offsets += std::to_string(offset) + ",";
+
+        std::string header =
+            "// Generated File - DO NOT EDIT\n"
+            "// Compressed from " + textPath.filename().string() + " by scripts/StringTableCompiler.cpp.\n"
+            "#pragma once\n"
+            "\n"
+            "#include <cstdint>\n"
+            "\n"
+            "#include \"ptui/StringTable.hpp\"\n"
+            "\n"
+            "static_assert(ptui::StringTable::maxDepth >= " + std::to_string(compressed.depth) + ", \"Pairs nest deeper than StringReader's stack\");\n"
+            "\n"
+            "// The strings' ids, e.g. ptui::StringReader(" + name + ", " + name + "Id::" + (entries.empty() ? std::string("name") : entries[0].name) + ").\n"
+            "struct " + name + "Id\n"
+            "{\n"
+            "    enum : uint16_t\n"
+            "    {\n" + ids +
+            "        count\n"
+            "    };\n"
+            "};\n"
+            "\n"
+            "inline constexpr char " + name + "Symbols[] = {" + symbols + "};\n";
+        if (!compressed.pairs.empty())
+            header += "inline constexpr uint8_t " + name + "Pairs[][2] = {" + pairs + "};\n";
+        header +=
+            "inline constexpr uint16_t " + name + "Offsets[] = {" + offsets + "};\n"
+            "inline constexpr uint8_t " + name + "Data[] = {\n" + data + "0};\n"
+            "\n"
+            "inline constexpr ptui::StringTable " + name + "{" + std::to_string(entries.size()) + ", " + std::to_string(compressed.symbols.size()) + ", "
+            + name + "Symbols, " + (compressed.pairs.empty() ? std::string("nullptr") : name + "Pairs") + ", " + name + "Offsets, " + name + "Data};\n";
+        return header;
+    }
+
+    void usage()
+    {
+        std::fprintf(stderr,
+                     "Usage: strtab <texts.txt>...\n"
+                     "  Compresses each text file into a header next to it, whose ptui::StringTable is named after the file.\n");
+    }
+}
+
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        usage();
+        return 1;
+    }
+
+    bool failed = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        fs::path textPath = argv[i];
+        std::string name = textPath.stem().string();
+        std::string source;
+        std::vector<Entry> entries;
+
+        if (!isIdentifier(name))
+        {
+            std::fprintf(stderr, "%s: the file's name must be an identifier\n", textPath.string().c_str());
+            failed = true;
+            continue;
+        }
+        if (!readFile(textPath, source))
+        {
+            std::fprintf(stderr, "Can't read %s\n", textPath.string().c_str());
+            failed = true;
+            continue;
+        }
+        if (!parseTexts(textPath, source, entries))
+        {
+            failed = true;
+            continue;
+        }
+
+        Compressed compressed;
+        std::size_t textSize = 0;
+        std::size_t dataSize = 0;
+
+        compress(entries, compressed);
+        for (std::size_t j = 0; j < entries.size(); j++)
+        {
+            textSize += entries[j].text.size() + 1;
+            dataSize += compressed.strings[j].size();
+        }
+        if (dataSize >= maxDataSize)
+        {
+            std::fprintf(stderr, "%s: %u bytes once compressed, split it so each file stays under 64KB\n", textPath.string().c_str(), unsigned(dataSize));
+            failed = true;
+            continue;
+        }
+
+        // What it all takes in flash, with the tables and the offsets.
+        std::size_t flashSize = compressed.symbols.size() + compressed.pairs.size() * 2 + (entries.size() + 1) * 2 + dataSize + 1;
+        fs::path headerPath = fs::path(textPath).replace_extension(".h");
+        bool written = writeIfChanged(headerPath, generateHeader(textPath, name, entries, compressed), failed);
+
+        std::printf("%s: %u strings, %u bytes as C strings, %u compressed (%u%%) with %u pairs, %s.\n", name.c_str(), unsigned(entries.size()),
+                    unsigned(textSize), unsigned(flashSize), unsigned(textSize ? flashSize * 100 / textSize : 0), unsigned(compressed.pairs.size()),
+                    written ? "updated" : "unchanged");
+    }
+    return failed ? 1 : 0;
+}
+
+
+#endif // !defined(POKITTO) && !defined(DESKTOP)
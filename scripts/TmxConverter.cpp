@@ -0,0 +1,1204 @@
+// Converts the Tiled TMX maps of assets/maps into assets/maps.h and a source per map in assets/maps/generated.
+// The TMX files should be orthogonal and in CSV format, with embedded tilesets.
+//
+// Build (Linux, needs libpng):
+//     g++ -std=c++17 -O2 -o tmxconv scripts/TmxConverter.cpp -lpng
+// Run from the project's root:
+//     ./tmxconv --palette <PokittoLib>/Pokitto/POKITTO_CORE/PALETTES/miloslav.h
+//
+// Each map is only re-read and re-composited when its TMX, its tilesets' PNGs or the palette changed,
+// the others are taken from a cache file. Generated files are only rewritten when their content changes:
+// a run with nothing to do doesn't trigger any recompilation, and editing a map's tiles usually only
+// recompiles its own source and Tiles.cpp.
+
+#if !defined(POKITTO) && !defined(DESKTOP)
+
+#include <png.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+namespace
+{
+    namespace fs = std::filesystem;
+
+    // Bump whenever the generated code or the cache format changes, to invalidate every cache entry.
+    constexpr const char* converterVersion = "tmxconv 4";
+    constexpr unsigned chunkSize = 16;
+    constexpr std::uint32_t flipFlags = 0xE0000000;
+    constexpr std::uint32_t flippedHorizontally = 0x80000000;
+    constexpr std::uint32_t flippedVertically = 0x40000000;
+    constexpr std::uint32_t flippedDiagonally = 0x20000000;
+    // Tile ids are a byte and 0xFF is the empty cell.
+    constexpr unsigned maxTileCount = 255;
+
+
+    // Minimal XML.
+
+    struct XMLNode
+    {
+        std::string name;
+        std::map<std::string, std::string> attributes;
+        std::vector<std::unique_ptr<XMLNode>> children;
+        std::string text;
+
+        std::string attribute(const std::string& key, const std::string& fallback = "") const
+        {
+            auto found = attributes.find(key);
+
+            return (found == attributes.end()) ? fallback : found->second;
+        }
+
+        const XMLNode* child(const std::string& childName) const
+        {
+            for (const auto& node : children)
+                if (node->name == childName)
+                    return node.get();
+            return nullptr;
+        }
+
+        // Every descendant with the given name, in document order.
+        void collect(const std::string& descendantName, std::vector<const XMLNode*>& found) const
+        {
+            for (const auto& node : children)
+            {
+                if (node->name == descendantName)
+                    found.push_back(node.get());
+                node->collect(descendantName, found);
+            }
+        }
+    };
+
+    std::string unescapeXML(const std::string& text)
+    {
+        static const std::pair<const char*, char> entities[] = {{"&lt;", '<'}, {"&gt;", '>'}, {"&quot;", '"'}, {"&apos;", '\''}, {"&amp;", '&'}};
+        std::string result;
+
+        for (std::size_t i = 0; i < text.size(); i++)
+        {
+            bool replaced = false;
+
+            if (text[i] == '&')
+                for (const auto& entity : entities)
+                    if (text.compare(i, std::strlen(entity.first), entity.first) == 0)
+                    {
+                        result += entity.second;
+                        i += std::strlen(entity.first) - 1;
+                        replaced = true;
+                        break;
+                    }
+            if (!replaced)
+                result += text[i];
+        }
+        return result;
+    }
+
+    bool parseXML(const std::string& source, XMLNode& root)
+    {
+        std::vector<XMLNode*> stack{&root};
+        std::size_t i = 0;
+
+        while (i < source.size())
+        {
+            if (source[i] != '<')
+            {
+                auto next = source.find('<', i);
+
+                stack.back()->text += unescapeXML(source.substr(i, next - i));
+                i = (next == std::string::npos) ? source.size() : next;
+                continue;
+            }
+            if ((source.compare(i, 4, "<!--") == 0) || (source.compare(i, 2, "<?") == 0) || (source.compare(i, 2, "<!") == 0))
+            {
+                auto end = source.find((source[i + 1] == '!' && source[i + 2] == '-') ? "-->" : ">", i);
+
+                if (end == std::string::npos)
+                    return false;
+                i = source.find('>', end) + 1;
+                continue;
+            }
+
+            auto end = source.find('>', i);
+
+            if (end == std::string::npos)
+                return false;
+
+            std::string tag = source.substr(i + 1, end - i - 1);
+
+            i = end + 1;
+            if (tag[0] == '/')
+            {
+                if (stack.size() <= 1)
+                    return false;
+                stack.pop_back();
+                continue;
+            }
+
+            bool selfClosing = tag.back() == '/';
+
+            if (selfClosing)
+                tag.pop_back();
+
+            auto node = std::make_unique<XMLNode>();
+            std::size_t position = tag.find_first_of(" \t\r\n");
+
+            node->name = tag.substr(0, position);
+            while (position != std::string::npos)
+            {
+                auto keyStart = tag.find_first_not_of(" \t\r\n", position);
+
+                if (keyStart == std::string::npos)
+                    break;
+
+                auto equal = tag.find('=', keyStart);
+                auto quote = (equal == std::string::npos) ? std::string::npos : tag.find_first_of("\"'", equal);
+
+                if (quote == std::string::npos)
+                    return false;
+
+                auto closing = tag.find(tag[quote], quote + 1);
+                std::string key = tag.substr(keyStart, equal - keyStart);
+
+                key.erase(key.find_last_not_of(" \t\r\n") + 1);
+                node->attributes[key] = unescapeXML(tag.substr(quote + 1, closing - quote - 1));
+                position = closing + 1;
+            }
+
+            XMLNode* raw = node.get();
+
+            stack.back()->children.push_back(std::move(node));
+            if (!selfClosing)
+                stack.push_back(raw);
+        }
+        return stack.size() == 1;
+    }
+
+
+    // Files.
+
+    bool readFile(const fs::path& path, std::string& content)
+    {
+        std::ifstream stream(path, std::ios::binary);
+
+        if (!stream)
+            return false;
+
+        std::ostringstream buffer;
+
+        buffer << stream.rdbuf();
+        content = buffer.str();
+        return true;
+    }
+
+    // FNV-1a.
+    std::uint64_t hashBytes(const std::string& bytes, std::uint64_t hash = 14695981039346656037ull)
+    {
+        for (unsigned char byte : bytes)
+            hash = (hash ^ byte) * 1099511628211ull;
+        return hash;
+    }
+
+    struct Image
+    {
+        unsigned width = 0;
+        unsigned height = 0;
+        // RGBA.
+        std::vector<std::uint8_t> pixels;
+    };
+
+    bool readPNG(const fs::path& path, Image& image)
+    {
+        png_image png;
+
+        std::memset(&png, 0, sizeof(png));
+        png.version = PNG_IMAGE_VERSION;
+        if (!png_image_begin_read_from_file(&png, path.string().c_str()))
+            return false;
+        png.format = PNG_FORMAT_RGBA;
+        image.width = png.width;
+        image.height = png.height;
+        image.pixels.resize(PNG_IMAGE_SIZE(png));
+        if (!png_image_finish_read(&png, nullptr, image.pixels.data(), 0, nullptr))
+        {
+            png_image_free(&png);
+            return false;
+        }
+        return true;
+    }
+
+    // Reads every number between the first '{' and the following '}', as {r, g, b} triplets.
+    bool readPalette(const fs::path& path, std::vector<std::uint8_t>& palette, std::string& content)
+    {
+        if (!readFile(path, content))
+            return false;
+
+        auto start = content.find('{');
+        auto end = content.find('}', start);
+
+        if ((start == std::string::npos) || (end == std::string::npos))
+            return false;
+
+        std::string body = content.substr(start + 1, end - start - 1);
+
+        for (std::size_t i = 0; i < body.size();)
+        {
+            if (!std::isdigit(static_cast<unsigned char>(body[i])))
+            {
+                i++;
+                continue;
+            }
+
+            std::size_t length;
+
+            palette.push_back(static_cast<std::uint8_t>(std::stoul(body.substr(i), &length, 0)));
+            i += length;
+        }
+        palette.resize(palette.size() / 3 * 3);
+        return !palette.empty();
+    }
+
+
+    // Maps.
+
+    struct TileSet
+    {
+        std::uint32_t firstGid;
+        unsigned columns;
+        unsigned tileCount;
+        fs::path imagePath;
+        // Property values of each tile with properties, in document order.
+        std::map<unsigned, std::vector<std::string>> properties;
+        const Image* image;
+    };
+
+    struct Layer
+    {
+        bool visible;
+        std::vector<std::uint32_t> gids;
+    };
+
+    struct Composite
+    {
+        std::string key;
+        // One palette index per pixel.
+        std::vector<std::uint8_t> pixels;
+    };
+
+    // Everything the code generation needs about a map. This is what the cache stores.
+    struct ConvertedMap
+    {
+        std::string name;
+        std::uint64_t hash = 0;
+        unsigned width = 0;
+        unsigned height = 0;
+        std::vector<Composite> composites;
+        // 1-based index into composites per cell, 0 for no tile.
+        std::vector<unsigned> cells;
+        // Event names per cell.
+        std::vector<std::vector<std::string>> events;
+    };
+
+    struct Converter
+    {
+        fs::path mapsFolder;
+        std::vector<std::uint8_t> palette;
+        std::map<std::uint32_t, std::uint8_t> paletteCache;
+        std::map<fs::path, std::unique_ptr<Image>> images;
+        unsigned tileWidth = 0;
+        unsigned tileHeight = 0;
+
+        const Image* image(const fs::path& path)
+        {
+            auto& slot = images[path];
+
+            if (!slot)
+            {
+                slot = std::make_unique<Image>();
+                if (!readPNG(path, *slot))
+                {
+                    std::fprintf(stderr, "Can't read %s\n", path.string().c_str());
+                    slot.reset();
+                    images.erase(path);
+                    return nullptr;
+                }
+            }
+            return slot.get();
+        }
+
+        std::uint8_t paletteIndex(const std::uint8_t* rgba)
+        {
+            if (rgba[3] < 128)
+                return 0;
+
+            std::uint32_t color = (rgba[0] << 16) | (rgba[1] << 8) | rgba[2];
+            auto found = paletteCache.find(color);
+
+            if (found != paletteCache.end())
+                return found->second;
+
+            unsigned best = 0;
+            long bestDistance = -1;
+
+            for (unsigned i = 0; i < palette.size() / 3; i++)
+            {
+                long dr = long(palette[i * 3]) - rgba[0];
+                long dg = long(palette[i * 3 + 1]) - rgba[1];
+                long db = long(palette[i * 3 + 2]) - rgba[2];
+                long distance = dr * dr + dg * dg + db * db;
+
+                if ((bestDistance < 0) || (distance < bestDistance))
+                {
+                    best = i;
+                    bestDistance = distance;
+                }
+            }
+            paletteCache[color] = best;
+            return best;
+        }
+
+        // Draws the tile over the RGBA composite, applying Tiled's flip flags.
+        void drawTile(const TileSet& tileSet, std::uint32_t id, std::vector<std::uint8_t>& composite)
+        {
+            std::uint32_t gid = id & ~flipFlags;
+            const Image& source = *tileSet.image;
+            unsigned index = gid - tileSet.firstGid;
+            unsigned sourceX = (index % tileSet.columns) * tileWidth;
+            unsigned sourceY = (index / tileSet.columns) * tileHeight;
+            std::vector<std::uint8_t> tile(tileWidth * tileHeight * 4, 0);
+
+            for (unsigned y = 0; y < tileHeight; y++)
+                for (unsigned x = 0; x < tileWidth; x++)
+                    if ((sourceX + x < source.width) && (sourceY + y < source.height))
+                        std::memcpy(&tile[(y * tileWidth + x) * 4], &source.pixels[((sourceY + y) * source.width + sourceX + x) * 4], 4);
+
+            auto transform = [&](auto sourceIndex) {
+                std::vector<std::uint8_t> out(tile.size());
+
+                for (unsigned y = 0; y < tileHeight; y++)
+                    for (unsigned x = 0; x < tileWidth; x++)
+                        std::memcpy(&out[(y * tileWidth + x) * 4], &tile[sourceIndex(x, y) * 4], 4);
+                tile = std::move(out);
+            };
+
+            if (id & flippedDiagonally)
+                transform([&](unsigned x, unsigned y) { return x * tileWidth + y; });
+            if (id & flippedHorizontally)
+                transform([&](unsigned x, unsigned y) { return y * tileWidth + tileWidth - 1 - x; });
+            if (id & flippedVertically)
+                transform([&](unsigned x, unsigned y) { return (tileHeight - y - 1) * tileWidth + x; });
+
+            for (unsigned i = 0; i < tileWidth * tileHeight; i++)
+                if (tile[i * 4 + 3] >= 128)
+                {
+                    std::memcpy(&composite[i * 4], &tile[i * 4], 3);
+                    composite[i * 4 + 3] = 255;
+                }
+        }
+
+        bool convert(const fs::path& tmxPath, const XMLNode& root, ConvertedMap& converted)
+        {
+            const XMLNode* map = root.child("map");
+
+            if (map == nullptr)
+                return false;
+            converted.width = std::stoul(map->attribute("width", "0"));
+            converted.height = std::stoul(map->attribute("height", "0"));
+            if (tileWidth == 0)
+            {
+                tileWidth = std::stoul(map->attribute("tilewidth", "0"));
+                tileHeight = std::stoul(map->attribute("tileheight", "0"));
+            }
+
+            std::vector<TileSet> tileSets;
+            std::vector<const XMLNode*> nodes;
+
+            map->collect("tileset", nodes);
+            for (auto node : nodes)
+            {
+                TileSet tileSet;
+                const XMLNode* imageNode = node->child("image");
+
+                if (imageNode == nullptr)
+                {
+                    std::fprintf(stderr, "%s: only embedded tilesets are supported\n", tmxPath.string().c_str());
+                    return false;
+                }
+                tileSet.firstGid = std::stoul(node->attribute("firstgid", "1"));
+                tileSet.columns = std::stoul(node->attribute("columns", "1"));
+                tileSet.tileCount = std::stoul(node->attribute("tilecount", "0"));
+                tileSet.imagePath = (mapsFolder / imageNode->attribute("source")).lexically_normal();
+                if ((tileSet.image = image(tileSet.imagePath)) == nullptr)
+                    return false;
+                for (const auto& tile : node->children)
+                {
+                    if (tile->name != "tile")
+                        continue;
+
+                    std::vector<const XMLNode*> properties;
+
+                    tile->collect("property", properties);
+                    for (auto property : properties)
+                        tileSet.properties[std::stoul(tile->attribute("id"))].push_back(property->attribute("value"));
+                }
+                tileSets.push_back(std::move(tileSet));
+            }
+            std::sort(tileSets.begin(), tileSets.end(), [](const TileSet& a, const TileSet& b) { return a.firstGid < b.firstGid; });
+
+            auto tileSetOf = [&](std::uint32_t gid) -> const TileSet* {
+                for (const auto& tileSet : tileSets)
+                    if ((gid >= tileSet.firstGid) && (gid < tileSet.firstGid + tileSet.tileCount))
+                        return &tileSet;
+                return nullptr;
+            };
+
+            std::vector<Layer> layers;
+
+            nodes.clear();
+            map->collect("layer", nodes);
+            for (auto node : nodes)
+            {
+                Layer layer;
+                const XMLNode* data = node->child("data");
+                std::vector<const XMLNode*> properties;
+                std::string visible = node->attribute("visible", "1");
+
+                // Layer properties override the layer's attributes.
+                node->collect("property", properties);
+                for (auto property : properties)
+                    if (property->attribute("name") == "visible")
+                        visible = property->attribute("value");
+
+                layer.visible = (visible != "0") && (visible != "false");
+                if (data != nullptr)
+                {
+                    std::stringstream csv(data->text);
+                    std::string value;
+
+                    while (std::getline(csv, value, ','))
+                        layer.gids.push_back(std::stoul(value));
+                }
+                layer.gids.resize(converted.width * converted.height, 0);
+                layers.push_back(std::move(layer));
+            }
+
+            std::map<std::string, unsigned> compositeIndices;
+
+            for (unsigned cell = 0; cell < converted.width * converted.height; cell++)
+            {
+                std::vector<std::uint32_t> visibleIds;
+                std::vector<std::string> events;
+
+                for (const auto& layer : layers)
+                {
+                    std::uint32_t id = layer.gids[cell];
+                    const TileSet* tileSet = tileSetOf(id & ~flipFlags);
+
+                    if ((id == 0) || (tileSet == nullptr))
+                        continue;
+
+                    auto properties = tileSet->properties.find((id & ~flipFlags) - tileSet->firstGid);
+
+                    if (properties != tileSet->properties.end())
+                        events.insert(events.end(), properties->second.begin(), properties->second.end());
+                    if (layer.visible)
+                        visibleIds.push_back(id);
+                }
+                converted.events.push_back(events);
+                if (visibleIds.empty())
+                {
+                    converted.cells.push_back(0);
+                    continue;
+                }
+
+                std::string key;
+
+                for (auto id : visibleIds)
+                    key += (key.empty() ? "" : ",") + tileSetOf(id & ~flipFlags)->imagePath.lexically_relative(mapsFolder.lexically_normal()).generic_string() + ":" + std::to_string(id);
+
+                auto& index = compositeIndices[key];
+
+                if (index == 0)
+                {
+                    std::vector<std::uint8_t> rgba(tileWidth * tileHeight * 4, 0);
+                    Composite composite{key, {}};
+
+                    for (auto id : visibleIds)
+                        drawTile(*tileSetOf(id & ~flipFlags), id, rgba);
+                    for (unsigned i = 0; i < tileWidth * tileHeight; i++)
+                        composite.pixels.push_back(paletteIndex(&rgba[i * 4]));
+                    converted.composites.push_back(std::move(composite));
+                    index = converted.composites.size();
+                }
+                converted.cells.push_back(index);
+            }
+            return true;
+        }
+    };
+
+
+    // Cache.
+
+    std::string hex(const std::vector<std::uint8_t>& bytes)
+    {
+        static const char digits[] = "0123456789abcdef";
+        std::string text;
+
+        for (auto byte : bytes)
+        {
+            text += digits[byte >> 4];
+            text += digits[byte & 15];
+        }
+        return text;
+    }
+
+    std::vector<std::uint8_t> unhex(const std::string& text)
+    {
+        std::vector<std::uint8_t> bytes;
+
+        for (std::size_t i = 0; i + 1 < text.size(); i += 2)
+            bytes.push_back(std::stoul(text.substr(i, 2), nullptr, 16));
+        return bytes;
+    }
+
+    // One map per block:
+    //   map <name> <hash> <width> <height> <composites>
+    //   composite <key>\n<pixels as hex>     (one per composite)
+    //   cells <index>...
+    //   events <comma-separated names or ->...
+    std::map<std::string, ConvertedMap> loadCache(const fs::path& path)
+    {
+        std::map<std::string, ConvertedMap> cache;
+        std::ifstream stream(path);
+        std::string line;
+
+        if (!std::getline(stream, line) || (line != converterVersion))
+            return cache;
+        while (std::getline(stream, line))
+        {
+            std::istringstream header(line);
+            std::string tag;
+            ConvertedMap converted;
+            unsigned compositeCount;
+
+            if (!(header >> tag >> converted.name >> std::hex >> converted.hash >> std::dec >> converted.width >> converted.height >> compositeCount) || (tag != "map"))
+                return {};
+            for (unsigned i = 0; i < compositeCount; i++)
+            {
+                std::string keyLine, pixelsLine;
+
+                if (!std::getline(stream, keyLine) || !std::getline(stream, pixelsLine) || (keyLine.compare(0, 10, "composite ") != 0))
+                    return {};
+                converted.composites.push_back({keyLine.substr(10), unhex(pixelsLine)});
+            }
+
+            std::string cellsLine, eventsLine;
+
+            if (!std::getline(stream, cellsLine) || !std::getline(stream, eventsLine))
+                return {};
+
+            std::istringstream cells(cellsLine);
+            std::istringstream events(eventsLine);
+            std::string word;
+
+            cells >> tag;
+            for (unsigned index; cells >> index;)
+                converted.cells.push_back(index);
+            events >> tag;
+            while (events >> word)
+            {
+                std::vector<std::string> names;
+                std::stringstream split(word);
+                std::string name;
+
+                while ((word != "-") && std::getline(split, name, ','))
+                    names.push_back(name);
+                converted.events.push_back(names);
+            }
+            if ((converted.cells.size() != converted.width * converted.height) || (converted.events.size() != converted.cells.size()))
+                return {};
+            cache[converted.name] = std::move(converted);
+        }
+        return cache;
+    }
+
+    void saveCache(const fs::path& path, const std::vector<ConvertedMap>& maps)
+    {
+        std::ofstream stream(path);
+
+        stream << converterVersion << "\n";
+        for (const auto& converted : maps)
+        {
+            stream << "map " << converted.name << " " << std::hex << converted.hash << std::dec << " " << converted.width << " " << converted.height << " " << converted.composites.size() << "\n";
+            for (const auto& composite : converted.composites)
+                stream << "composite " << composite.key << "\n" << hex(composite.pixels) << "\n";
+            stream << "cells";
+            for (auto index : converted.cells)
+                stream << " " << index;
+            stream << "\nevents";
+            for (const auto& names : converted.events)
+            {
+                std::string joined;
+
+                for (const auto& name : names)
+                    joined += (joined.empty() ? "" : ",") + name;
+                stream << " " << (joined.empty() ? "-" : joined);
+            }
+            stream << "\n";
+        }
+    }
+
+
+    // Code generation.
+
+    std::string hexByte(unsigned value)
+    {
+        char text[8];
+
+        std::snprintf(text, sizeof(text), "0x%02x", value & 0xFF);
+        return text;
+    }
+
+    template<class ContainerT, class FormatT>
+    std::string join(const ContainerT& values, const std::string& separator, FormatT format)
+    {
+        std::string text;
+        bool first = true;
+
+        for (const auto& value : values)
+        {
+            if (!first)
+                text += separator;
+            text += format(value);
+            first = false;
+        }
+        return text;
+    }
+
+    std::string firstEvent(const std::vector<std::string>& events)
+    {
+        return events.empty() ? "EMPTY" : events[0];
+    }
+
+    template<class ValueT>
+    std::vector<std::string> rleEncode(const std::vector<ValueT>& values)
+    {
+        std::vector<std::string> out;
+
+        for (std::size_t i = 0; i < values.size();)
+        {
+            std::size_t run = 1;
+
+            while ((run < 255) && (i + run < values.size()) && (values[i + run] == values[i]))
+                run++;
+            out.push_back(std::to_string(run));
+            out.push_back(values[i]);
+            i += run;
+        }
+        return out;
+    }
+
+    // Splits the map into chunkSize x chunkSize chunks of tiles and events, each RLE-encoded as (run, value) pairs.
+    // Cells past the map's edges are padded with the empty cell, 0xFF, and EMPTY.
+    std::string emitChunks(const ConvertedMap& map, const std::vector<std::string>& tileValues)
+    {
+        unsigned columns = (map.width + chunkSize - 1) / chunkSize;
+        unsigned rows = (map.height + chunkSize - 1) / chunkSize;
+        std::vector<std::string> tileChunks, eventChunks;
+        std::string acc;
+
+        for (unsigned cy = 0; cy < rows; cy++)
+            for (unsigned cx = 0; cx < columns; cx++)
+            {
+                std::vector<std::string> tiles, events;
+
+                for (unsigned y = cy * chunkSize; y < (cy + 1) * chunkSize; y++)
+                    for (unsigned x = cx * chunkSize; x < (cx + 1) * chunkSize; x++)
+                    {
+                        bool inside = (x < map.width) && (y < map.height);
+
+                        tiles.push_back(inside ? tileValues[y * map.width + x] : hexByte(0xFF));
+                        events.push_back(inside ? firstEvent(map.events[y * map.width + x]) : "EMPTY");
+                    }
+
+                std::string suffix = std::to_string(cx) + "_" + std::to_string(cy);
+                auto identity = [](const std::string& value) { return value; };
+
+                acc += "static const uint8_t " + map.name + "TileChunk" + suffix + "[] = {" + join(rleEncode(tiles), ", ", identity) + "};\n";
+                acc += "static const uint8_t " + map.name + "EventChunk" + suffix + "[] = {" + join(rleEncode(events), ", ", identity) + "};\n";
+                tileChunks.push_back(map.name + "TileChunk" + suffix);
+                eventChunks.push_back(map.name + "EventChunk" + suffix);
+            }
+
+        auto identity = [](const std::string& value) { return value; };
+
+        acc += "static const uint8_t* const " + map.name + "TileChunks[] = {" + join(tileChunks, ", ", identity) + "};\n";
+        acc += "static const uint8_t* const " + map.name + "EventChunks[] = {" + join(eventChunks, ", ", identity) + "};\n";
+        acc += "const world::ChunkedMapData " + map.name + "Chunked = {" + std::to_string(map.width) + ", " + std::to_string(map.height) + ", "
+            + std::to_string(columns) + ", " + std::to_string(rows) + ", " + map.name + "TileChunks, " + map.name + "EventChunks};\n";
+        return acc;
+    }
+
+    // The sorted ids of the tiles the map draws, so that only those are registered with the Tilemap.
+    // Empty cells, the chunks' padding included, are 0xFF and left unregistered, so Tilemap leaves them blank.
+    std::vector<std::string> usedTileIds(const std::vector<std::string>& tileValues)
+    {
+        std::vector<std::string> ids;
+
+        for (const auto& value : tileValues)
+            if (value != hexByte(0xFF))
+                ids.push_back(value);
+        std::sort(ids.begin(), ids.end());
+        ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+        return ids;
+    }
+
+    // Emits the values packed on `bits` bits each, LSB first, with no padding between rows, 16 bytes per line.
+    std::string emitPackedCells(const std::string& name, const std::vector<unsigned>& values, unsigned bits)
+    {
+        std::vector<unsigned> bytes((values.size() * bits + 7) / 8, 0);
+
+        for (std::size_t i = 0; i < values.size(); i++)
+            bytes[(i * bits) >> 3] |= values[i] << ((i * bits) & 7);
+
+        std::string acc = "static const uint8_t " + name + "[] = {\n";
+
+        for (std::size_t i = 0; i < bytes.size(); i += 16)
+        {
+            std::vector<unsigned> line(bytes.begin() + i, bytes.begin() + std::min(i + 16, bytes.size()));
+
+            acc += join(line, ", ", hexByte) + ((i + 16 < bytes.size()) ? ",\n" : "\n");
+        }
+        return acc + "};\n";
+    }
+
+    // Packs the first event of each cell on as few bits as the event count allows.
+    std::string emitEventLayer(const ConvertedMap& map, const std::vector<std::string>& eventValues)
+    {
+        unsigned bits = (eventValues.size() < 4) ? 2 : 4;
+        std::vector<unsigned> values;
+
+        for (const auto& events : map.events)
+            values.push_back(events.empty() ? 0 : std::find(eventValues.begin(), eventValues.end(), events[0]) - eventValues.begin() + 1);
+
+        std::string acc = emitPackedCells(map.name + "EventCells", values, bits);
+
+        acc += "const world::EventLayerData " + map.name + "Events = {" + std::to_string(map.width) + ", " + std::to_string(map.height) + ", "
+            + std::to_string(bits) + ", " + map.name + "EventCells};\n";
+        return acc;
+    }
+
+    // Merges contiguous tiles sharing an event into rectangles, greedily, sorted by top row then column.
+    // Collide isn't a trigger: it's handled by the packed event layer.
+    std::string emitTriggers(const ConvertedMap& map)
+    {
+        unsigned w = map.width, h = map.height;
+        auto eventAt = [&](unsigned x, unsigned y) { return firstEvent(map.events[y * w + x]); };
+        std::vector<bool> used(w * h, false);
+        std::vector<std::string> rects;
+        unsigned maxHeight = 0;
+
+        for (unsigned y = 0; y < h; y++)
+            for (unsigned x = 0; x < w; x++)
+            {
+                std::string event = eventAt(x, y);
+
+                if (used[y * w + x] || (event == "EMPTY") || (event == "Collide"))
+                    continue;
+
+                unsigned rw = 1, rh = 1;
+
+                while ((x + rw < w) && !used[y * w + x + rw] && (eventAt(x + rw, y) == event))
+                    rw++;
+                for (; y + rh < h; rh++)
+                {
+                    bool fits = true;
+
+                    for (unsigned i = 0; (i < rw) && fits; i++)
+                        fits = !used[(y + rh) * w + x + i] && (eventAt(x + i, y + rh) == event);
+                    if (!fits)
+                        break;
+                }
+                for (unsigned j = 0; j < rh; j++)
+                    for (unsigned i = 0; i < rw; i++)
+                        used[(y + j) * w + x + i] = true;
+                rects.push_back("{" + std::to_string(x) + ", " + std::to_string(y) + ", " + std::to_string(rw) + ", " + std::to_string(rh) + ", " + event + "}");
+                maxHeight = std::max(maxHeight, rh);
+            }
+
+        std::string acc = "static const world::TriggerRect " + map.name + "TriggerRects[] = {\n\t" + join(rects, ",\n\t", [](const std::string& rect) { return rect; }) + "\n};\n";
+
+        acc += "const world::TriggerIndexData " + map.name + "Triggers = {" + std::to_string(rects.size()) + ", " + std::to_string(maxHeight) + ", " + map.name + "TriggerRects};\n";
+        return acc;
+    }
+
+    struct Statistics
+    {
+        unsigned composites = 0;
+        unsigned tiles = 0;
+    };
+
+    // The manifest header, and the sources by file name.
+    struct GeneratedFiles
+    {
+        std::string header;
+        std::vector<std::pair<std::string, std::string>> sources;
+    };
+
+    // The sources shared by every map. Maps can't use these names.
+    constexpr const char* tilesSource = "Tiles.cpp";
+    constexpr const char* mapTableSource = "MapTable.cpp";
+
+    GeneratedFiles generate(const std::vector<ConvertedMap>& maps, unsigned tileWidth, unsigned tileHeight, Statistics& statistics)
+    {
+        // Composites are shared by every map, by pixels: different layer stacks drawing the same tile share its id.
+        std::vector<const Composite*> composites;
+        std::map<std::vector<std::uint8_t>, unsigned> tileIds;
+        std::vector<std::string> eventValues;
+        std::vector<std::vector<std::string>> tileValues(maps.size());
+        GeneratedFiles files;
+
+        for (std::size_t m = 0; m < maps.size(); m++)
+        {
+            const auto& map = maps[m];
+            // The tile id (1-based) of each of the map's composites.
+            std::vector<unsigned> locals(map.composites.size(), 0);
+
+            for (auto local : map.cells)
+            {
+                if (local == 0)
+                {
+                    tileValues[m].push_back(hexByte(0xFF));
+                    continue;
+                }
+
+                auto& tile = locals[local - 1];
+
+                if (tile == 0)
+                {
+                    const auto& composite = map.composites[local - 1];
+                    auto found = tileIds.find(composite.pixels);
+
+                    statistics.composites++;
+                    if (found != tileIds.end())
+                        tile = found->second;
+                    else
+                    {
+                        composites.push_back(&composite);
+                        tile = composites.size();
+                        tileIds.emplace(composite.pixels, tile);
+                    }
+                }
+                tileValues[m].push_back(hexByte(tile - 1));
+            }
+            for (const auto& names : map.events)
+                for (const auto& name : names)
+                    if (std::find(eventValues.begin(), eventValues.end(), name) == eventValues.end())
+                        eventValues.push_back(name);
+        }
+        statistics.tiles = composites.size();
+
+        // One source per map. The event values are only known once every map has been read.
+        std::string declarations;
+        std::string tableEntries;
+
+        for (std::size_t m = 0; m < maps.size(); m++)
+        {
+            const auto& map = maps[m];
+            std::string guard = "#ifndef MAPS_EXCLUDE_" + map.name + "\n";
+            std::string acc = "// Generated File - DO NOT EDIT\n#include \"maps.h\"\n\n" + guard + "\n";
+
+            acc += "const uint8_t " + map.name + "[] = {\n";
+            acc += std::to_string(map.width) + ", " + std::to_string(map.height) + ",\n";
+            for (unsigned y = 0; y < map.height; y++)
+            {
+                std::vector<std::string> row(tileValues[m].begin() + y * map.width, tileValues[m].begin() + (y + 1) * map.width);
+
+                acc += join(row, ", ", [](const std::string& value) { return value; }) + ((y + 1 < map.height) ? ",\n" : "");
+            }
+            acc += "\n};\n";
+            acc += "MapEnum " + map.name + "Enum(uint32_t x, uint32_t y){\nstatic const MapEnum parameters[] = {\n\t";
+            acc += join(map.events, ",\n\t", [](const std::vector<std::string>& names) {
+                return names.empty() ? std::string("EMPTY") : join(names, ", ", [](const std::string& name) { return name; });
+            });
+            acc += "\n    };\n    return (x >= " + std::to_string(map.width) + " || y >= " + std::to_string(map.height) + ") ? EMPTY : parameters[y * "
+                + std::to_string(map.width) + " + x];\n}\n";
+            acc += emitChunks(map, tileValues[m]);
+            auto tileIds = usedTileIds(tileValues[m]);
+
+            acc += "const uint8_t " + map.name + "TileIds[] = {" + join(tileIds, ", ", [](const std::string& id) { return id; }) + "};\n";
+            acc += emitEventLayer(map, eventValues);
+            acc += emitTriggers(map);
+            acc += "\n#endif // MAPS_EXCLUDE_" + map.name + "\n";
+            files.sources.emplace_back(map.name + ".cpp", acc);
+
+            declarations += "\n" + guard;
+            declarations += "extern const uint8_t " + map.name + "[];\n";
+            declarations += "extern const uint8_t " + map.name + "TileIds[" + std::to_string(tileIds.size()) + "];\n";
+            declarations += "MapEnum " + map.name + "Enum(uint32_t x, uint32_t y);\n";
+            declarations += "extern const world::ChunkedMapData " + map.name + "Chunked;\n";
+            declarations += "extern const world::EventLayerData " + map.name + "Events;\n";
+            declarations += "extern const world::TriggerIndexData " + map.name + "Triggers;\n";
+            declarations += "#endif\n";
+
+            tableEntries += guard;
+            tableEntries += "    {\"" + map.name + "\", " + map.name + ", " + map.name + "TileIds, sizeof(" + map.name + "TileIds), &" + map.name + "Chunked, &" + map.name + "Events, &" + map.name + "Triggers},\n";
+            tableEntries += "#endif\n";
+        }
+
+        std::string tileSize = std::to_string(tileWidth) + " * " + std::to_string(tileHeight);
+
+        files.header =
+            "// Generated File - DO NOT EDIT\n"
+            "// Define MAPS_EXCLUDE_<name> in the build flags to leave a map out of the build.\n"
+            "#pragma once\n"
+            "\n"
+            "#include \"world/ChunkedMapData.hpp\"\n"
+            "#include \"world/EventLayerData.hpp\"\n"
+            "#include \"world/TriggerIndexData.hpp\"\n"
+            "#include \"world/MapTable.hpp\"\n"
+            "\n"
+            "enum MapEnum {\n"
+            "    EMPTY = 0,\n"
+            "    " + join(eventValues, ",\n\t", [](const std::string& name) { return name; }) + "\n"
+            "};\n"
+            "\n"
+            "extern const uint8_t tiles[" + std::to_string(composites.size()) + " * " + tileSize + "];\n"
+            + declarations +
+            "\n"
+            "// Every map of the build, followed by an empty entry.\n"
+            "extern const world::MapTableEntry mapTable[];\n"
+            "extern const uint32_t mapCount;\n";
+
+        std::string tiles = "// Generated File - DO NOT EDIT\n#include \"maps.h\"\n\nconst uint8_t tiles[] = {\n";
+
+        for (auto composite : composites)
+        {
+            for (std::size_t i = 0; i < composite->pixels.size(); i += tileWidth)
+            {
+                std::vector<std::uint8_t> row(composite->pixels.begin() + i, composite->pixels.begin() + i + tileWidth);
+
+                tiles += join(row, ",", [](std::uint8_t value) { return hexByte(value); }) + ((i + tileWidth < composite->pixels.size()) ? ",\n" : "");
+            }
+            tiles += ",\n\n";
+        }
+        tiles += "};\n";
+        files.sources.emplace_back(tilesSource, tiles);
+        files.sources.emplace_back(mapTableSource,
+            "// Generated File - DO NOT EDIT\n#include \"maps.h\"\n\n"
+            "const world::MapTableEntry mapTable[] = {\n" + tableEntries + "    {}\n};\n"
+            "const uint32_t mapCount = sizeof(mapTable) / sizeof(mapTable[0]) - 1;\n");
+        return files;
+    }
+
+    // Returns whether the file had to be written, which leaves up-to-date files and their objects untouched.
+    bool writeIfChanged(const fs::path& path, const std::string& content, bool& failed)
+    {
+        std::string previous;
+
+        if (readFile(path, previous) && (previous == content))
+            return false;
+
+        std::ofstream stream(path, std::ios::binary);
+
+        stream << content;
+        if (!stream)
+        {
+            std::fprintf(stderr, "Can't write %s\n", path.string().c_str());
+            failed = true;
+        }
+        return true;
+    }
+
+    void usage()
+    {
+        std::fprintf(stderr,
+                     "Usage: tmxconv --palette <palette.h> [--maps <folder>] [--output <maps.h>] [--sources <folder>] [--cache <file>] [--force]\n"
+                     "  --palette  The PokittoLib palette header the tiles are converted with (e.g. miloslav.h).\n"
+                     "  --maps     The folder with the TMX maps and their tilesets (default: assets/maps).\n"
+                     "  --output   The generated manifest header (default: assets/maps.h).\n"
+                     "  --sources  Where the generated sources go, one per map plus the tiles and the map table.\n"
+                     "             Other sources found there are deleted (default: <maps>/generated).\n"
+                     "  --cache    Where converted maps are kept between runs (default: <maps>/.tmxconv-cache).\n"
+                     "  --force    Reconverts every map.\n");
+    }
+}
+
+
+int main(int argc, char** argv)
+{
+    fs::path palettePath;
+    fs::path mapsFolder = fs::path("assets") / "maps";
+    fs::path outputPath = fs::path("assets") / "maps.h";
+    fs::path sourcesFolder;
+    fs::path cachePath;
+    bool force = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        std::string argument = argv[i];
+        bool hasValue = i + 1 < argc;
+
+        if ((argument == "--palette") && hasValue)
+            palettePath = argv[++i];
+        else if ((argument == "--maps") && hasValue)
+            mapsFolder = argv[++i];
+        else if ((argument == "--output") && hasValue)
+            outputPath = argv[++i];
+        else if ((argument == "--sources") && hasValue)
+            sourcesFolder = argv[++i];
+        else if ((argument == "--cache") && hasValue)
+            cachePath = argv[++i];
+        else if (argument == "--force")
+            force = true;
+        else
+        {
+            usage();
+            return 1;
+        }
+    }
+    if (palettePath.empty())
+    {
+        usage();
+        return 1;
+    }
+    if (cachePath.empty())
+        cachePath = mapsFolder / ".tmxconv-cache";
+    if (sourcesFolder.empty())
+        sourcesFolder = mapsFolder / "generated";
+
+    Converter converter;
+    std::string paletteSource;
+
+    converter.mapsFolder = mapsFolder;
+    if (!readPalette(palettePath, converter.palette, paletteSource))
+    {
+        std::fprintf(stderr, "Can't read the palette %s\n", palettePath.string().c_str());
+        return 1;
+    }
+
+    std::vector<fs::path> tmxPaths;
+
+    for (const auto& entry : fs::directory_iterator(mapsFolder))
+    {
+        std::string extension = entry.path().extension().string();
+
+        std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char c) { return std::tolower(c); });
+        if (entry.is_regular_file() && (extension == ".tmx"))
+            tmxPaths.push_back(entry.path());
+    }
+    std::sort(tmxPaths.begin(), tmxPaths.end());
+
+    auto cache = force ? std::map<std::string, ConvertedMap>() : loadCache(cachePath);
+    std::vector<ConvertedMap> maps;
+    unsigned reconverted = 0;
+
+    for (const auto& tmxPath : tmxPaths)
+    {
+        std::string source;
+        XMLNode root;
+
+        if (!readFile(tmxPath, source) || !parseXML(source, root))
+        {
+            std::fprintf(stderr, "Can't parse %s\n", tmxPath.string().c_str());
+            return 1;
+        }
+
+        // The hash covers everything the conversion reads: the TMX, its tilesets' images and the palette.
+        std::uint64_t hash = hashBytes(paletteSource, hashBytes(source, hashBytes(converterVersion)));
+        std::vector<const XMLNode*> images;
+
+        root.collect("image", images);
+        for (auto image : images)
+        {
+            std::string bytes;
+
+            if (!readFile(mapsFolder / image->attribute("source"), bytes))
+            {
+                std::fprintf(stderr, "%s: can't read %s\n", tmxPath.string().c_str(), image->attribute("source").c_str());
+                return 1;
+            }
+            hash = hashBytes(bytes, hash);
+        }
+
+        std::string name = tmxPath.stem().string();
+
+        if ((name + ".cpp" == tilesSource) || (name + ".cpp" == mapTableSource))
+        {
+            std::fprintf(stderr, "%s: the map's name is reserved\n", tmxPath.string().c_str());
+            return 1;
+        }
+        auto cached = cache.find(name);
+
+        if (const XMLNode* map = root.child("map"); (map != nullptr) && (converter.tileWidth == 0))
+        {
+            converter.tileWidth = std::stoul(map->attribute("tilewidth", "0"));
+            converter.tileHeight = std::stoul(map->attribute("tileheight", "0"));
+        }
+        if ((cached != cache.end()) && (cached->second.hash == hash))
+        {
+            maps.push_back(std::move(cached->second));
+            continue;
+        }
+
+        ConvertedMap converted;
+
+        converted.name = name;
+        converted.hash = hash;
+        if (!converter.convert(tmxPath, root, converted))
+        {
+            std::fprintf(stderr, "Can't convert %s\n", tmxPath.string().c_str());
+            return 1;
+        }
+        maps.push_back(std::move(converted));
+        reconverted++;
+    }
+
+    Statistics statistics;
+    GeneratedFiles files = generate(maps, converter.tileWidth, converter.tileHeight, statistics);
+
+    if (statistics.tiles > maxTileCount)
+    {
+        std::fprintf(stderr, "%u tiles, only %u fit in a map byte\n", statistics.tiles, maxTileCount);
+        return 1;
+    }
+
+    std::error_code error;
+    bool failed = false;
+    unsigned written = writeIfChanged(outputPath, files.header, failed);
+
+    fs::create_directories(sourcesFolder, error);
+    for (const auto& source : files.sources)
+        written += writeIfChanged(sourcesFolder / source.first, source.second, failed);
+
+    // Removed maps.
+    for (const auto& entry : fs::directory_iterator(sourcesFolder, error))
+    {
+        std::string fileName = entry.path().filename().string();
+        bool generated = std::any_of(files.sources.begin(), files.sources.end(), [&](const auto& source) { return source.first == fileName; });
+
+        if ((entry.path().extension() == ".cpp") && !generated)
+        {
+            fs::remove(entry.path(), error);
+            written++;
+        }
+    }
+    if (failed)
+        return 1;
+    saveCache(cachePath, maps);
+    std::printf("%u map(s), %u reconverted, %u tiles for %u composites, %u file(s) updated.\n", unsigned(maps.size()), reconverted, statistics.tiles,
+                statistics.composites, written);
+    return 0;
+}
+
+
+#endif // !defined(POKITTO) && !defined(DESKTOP)
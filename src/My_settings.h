@@ -1,4 +1,5 @@
 #include "ptui/TASLineFiller.hpp"
+#include "gfx/TASLineFiller.hpp"
 
 
 void GameFiller(std::uint8_t* line, std::uint32_t y, bool skip) noexcept;
@@ -8,8 +9,10 @@ void GameFiller(std::uint8_t* line, std::uint32_t y, bool skip) noexcept;
 #define PROJ_TILE_W 16
 #define MAX_TILE_COUNT 256
 #define PROJ_FPS 250
+// The frame rate scenes are budgeted for. PROJ_FPS only caps the frame rate, and no scene renders that fast.
+#define PROJ_TARGET_FPS 50
 #define PROJ_USE_FPS_COUNTER
 #define PROJ_BUTTONS_POLLING_ONLY
 
 //#define PROJ_LINE_FILLERS GameFiller
-#define PROJ_LINE_FILLERS TAS::BGTileFiller, TAS::SpriteFiller, ptui::TerminalTMFiller
+#define PROJ_LINE_FILLERS TAS::BGTileFiller, gfx::SpriteBatchFiller, ptui::TerminalTMFiller
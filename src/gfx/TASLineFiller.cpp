@@ -0,0 +1,12 @@
+#include "gfx/TASLineFiller.hpp"
+
+#include "gfx/TASSpriteBatch.hpp"
+
+
+namespace gfx
+{
+    void SpriteBatchFiller(std::uint8_t* line, std::uint32_t y, bool skip) noexcept
+    {
+        tasSpriteBatch.renderIntoLineBuffer(line, y, skip);
+    }
+}
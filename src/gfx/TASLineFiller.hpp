@@ -0,0 +1,14 @@
+#ifndef GFX_TASLINEFILLER_HPP
+#   define GFX_TASLINEFILLER_HPP
+
+#   include <cstdint>
+
+
+namespace gfx
+{
+    // A filler which renders the sprites queued into gfx::tasSpriteBatch.
+    void SpriteBatchFiller(std::uint8_t* line, std::uint32_t y, bool skip) noexcept;
+};
+
+
+#endif // GFX_TASLINEFILLER_HPP
@@ -0,0 +1,165 @@
+#include "gfx/TASSpriteBatch.hpp"
+
+#include <algorithm>
+
+
+namespace gfx
+{
+    SpriteBatch tasSpriteBatch;
+    
+    namespace
+    {
+        // Returns the row following a span-encoded row.
+        const std::uint8_t* skipSpanRow(const std::uint8_t* row) noexcept
+        {
+            for (unsigned spans = *row++; spans > 0; spans--)
+                row += 2 + row[1];
+            return row;
+        }
+        
+        // Copies a span-encoded row, clipped to [firstColumn; lastColumn[, and returns the following row.
+        const std::uint8_t* copySpanRow(const std::uint8_t* row, std::uint8_t* destination, unsigned firstColumn, unsigned lastColumn) noexcept
+        {
+            for (unsigned spans = *row++; spans > 0; spans--)
+            {
+                unsigned start = row[0];
+                unsigned length = row[1];
+                const std::uint8_t* pixels = row + 2;
+                
+                row = pixels + length;
+                if (start < firstColumn)
+                {
+                    if (start + length <= firstColumn)
+                        continue;
+                    pixels += firstColumn - start;
+                    length -= firstColumn - start;
+                    start = firstColumn;
+                }
+                if (start + length > lastColumn)
+                {
+                    if (start >= lastColumn)
+                        continue;
+                    length = lastColumn - start;
+                }
+                std::copy(pixels, pixels + length, destination + start);
+            }
+            return row;
+        }
+    }
+    
+    bool SpriteBatch::draw(int x, int y, const std::uint8_t* sprite) noexcept
+    {
+        int firstColumn, lastColumn;
+        auto entry = _queue(x, y, sprite, firstColumn, lastColumn);
+        
+        if (entry == nullptr)
+            return false;
+        entry->pixels = sprite + 2 + (entry->top - y) * sprite[0] + firstColumn;
+        entry->stride = sprite[0];
+        entry->x = x + firstColumn;
+        entry->width = lastColumn - firstColumn;
+        return true;
+    }
+    
+    bool SpriteBatch::drawSpans(int x, int y, const std::uint8_t* sprite) noexcept
+    {
+        int firstColumn, lastColumn;
+        auto entry = _queue(x, y, sprite, firstColumn, lastColumn);
+        
+        if (entry == nullptr)
+            return false;
+        
+        const std::uint8_t* row = sprite + 2;
+        
+        for (int skipped = entry->top - y; skipped > 0; skipped--)
+            row = skipSpanRow(row);
+        entry->pixels = row;
+        entry->stride = 0;
+        entry->x = x;
+        entry->firstColumn = firstColumn;
+        entry->lastColumn = lastColumn;
+        return true;
+    }
+    
+    SpriteBatch::Entry* SpriteBatch::_queue(int x, int y, const std::uint8_t* sprite, int& firstColumn, int& lastColumn) noexcept
+    {
+        int width = sprite[0];
+        int height = sprite[1];
+        int top = (y < 0) ? 0 : y;
+        int bottom = (y + height > screenHeight) ? screenHeight : y + height;
+        
+        firstColumn = (x < 0) ? -x : 0;
+        lastColumn = (x + width > screenWidth) ? screenWidth - x : width;
+        if ((_count == capacity) || (firstColumn >= lastColumn) || (top >= bottom))
+            return nullptr;
+        
+        auto& entry = _entries[_count++];
+        
+        entry.top = top;
+        entry.bottom = bottom;
+        return &entry;
+    }
+    
+    void SpriteBatch::renderIntoLineBuffer(std::uint8_t* line, std::uint32_t y, bool skip) noexcept
+    {
+        if (y == 0)
+            _beginFrame();
+        
+        // Retires the sprites above this line, keeping the queue order.
+        unsigned kept = 0;
+        
+        for (unsigned i = 0; i < _activeCount; i++)
+            if (_entries[_active[i]].bottom > int(y))
+                _active[kept++] = _active[i];
+        _activeCount = kept;
+        
+        // Activates the sprites starting on this line.
+        while ((_cursor < _count) && (_entries[_order[_cursor]].top <= int(y)))
+        {
+            auto index = _order[_cursor++];
+            unsigned position = _activeCount++;
+            
+            for (; (position > 0) && (_active[position - 1] > index); position--)
+                _active[position] = _active[position - 1];
+            _active[position] = index;
+        }
+        
+        for (unsigned i = 0; i < _activeCount; i++)
+        {
+            auto& entry = _entries[_active[i]];
+            
+            if (entry.stride == 0)
+            {
+                // Span-encoded rows are read in sequence, even when skipped.
+                entry.pixels = skip ? skipSpanRow(entry.pixels) : copySpanRow(entry.pixels, line + entry.x, entry.firstColumn, entry.lastColumn);
+            }
+            else if (!skip)
+            {
+                const std::uint8_t* source = entry.pixels + (y - entry.top) * entry.stride;
+                std::uint8_t* destination = line + entry.x;
+                
+                for (unsigned column = 0; column < entry.width; column++)
+                    if (auto color = source[column])
+                        destination[column] = color;
+            }
+        }
+        
+        if (y == screenHeight - 1)
+            _count = 0;
+    }
+    
+    void SpriteBatch::_beginFrame() noexcept
+    {
+        // Insertion sort: sprites are few, and often queued in nearly the same order every frame.
+        for (unsigned i = 0; i < _count; i++)
+        {
+            unsigned position = i;
+            
+            for (; (position > 0) && (_entries[_order[position - 1]].top > _entries[i].top); position--)
+                _order[position] = _order[position - 1];
+            _order[position] = i;
+        }
+        _cursor = 0;
+        _activeCount = 0;
+    }
+}
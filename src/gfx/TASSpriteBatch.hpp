@@ -0,0 +1,72 @@
+#ifndef GFX_TASSPRITEBATCH_HPP
+#   define GFX_TASSPRITEBATCH_HPP
+
+#   include "Pokitto.h"
+
+#   include <cstdint>
+
+
+namespace gfx
+{
+    // Queues 8bpp sprites for the next frame and composites them line by line.
+    // Sprites are clipped to the screen when queued and sorted by top row once per frame,
+    // so each line only walks the sprites actually crossing it.
+    class SpriteBatch
+    {
+    public:
+        static constexpr unsigned capacity = 64;
+        static constexpr int screenWidth = PROJ_LCDWIDTH;
+        static constexpr int screenHeight = PROJ_LCDHEIGHT;
+        
+        // Queues a sprite in the Pokitto format ({width, height, pixels...}), 0 being transparent.
+        // Sprites queued later are drawn on top. Returns false if the sprite is offscreen or the batch is full.
+        bool draw(int x, int y, const std::uint8_t* sprite) noexcept;
+        
+        // Same as draw(), for span-encoded sprites ({width, height, then per row: span count, (start, length, pixels...)*}).
+        // Spans are copied as is, with no transparency test.
+        bool drawSpans(int x, int y, const std::uint8_t* sprite) noexcept;
+        
+        // Renders the queued sprites into the line. The batch is emptied once the last line is rendered.
+        void renderIntoLineBuffer(std::uint8_t* line, std::uint32_t y, bool skip) noexcept;
+        
+        unsigned size() const noexcept { return _count; }
+        
+    private:
+        struct Entry
+        {
+            // Plain sprites: pixels of the first visible column of the first visible row.
+            // Span-encoded sprites: the next row to render.
+            const std::uint8_t* pixels;
+            // Plain sprites: the sprite's width. 0 for span-encoded sprites.
+            std::uint16_t stride;
+            // Plain sprites: the first visible column on screen. Span-encoded sprites: the sprite's left.
+            std::int16_t x;
+            // Visible rows, [top; bottom[, clipped to the screen.
+            std::int16_t top;
+            std::int16_t bottom;
+            // Plain sprites: the visible width.
+            std::uint8_t width;
+            // Span-encoded sprites: visible columns, [firstColumn; lastColumn[, relative to x.
+            std::uint8_t firstColumn;
+            std::uint8_t lastColumn;
+        };
+        
+        Entry* _queue(int x, int y, const std::uint8_t* sprite, int& firstColumn, int& lastColumn) noexcept;
+        void _beginFrame() noexcept;
+        
+        Entry _entries[capacity];
+        // Entries sorted by top row.
+        std::uint8_t _order[capacity];
+        // Entries crossing the current line, in queue order.
+        std::uint8_t _active[capacity];
+        std::uint8_t _count = 0;
+        std::uint8_t _activeCount = 0;
+        // Next entry of _order to become active.
+        std::uint8_t _cursor = 0;
+    };
+    
+    extern SpriteBatch tasSpriteBatch;
+}
+
+
+#endif // GFX_TASSPRITEBATCH_HPP
@@ -0,0 +1,85 @@
+#include "input/Buttons.hpp"
+
+#include <Pokitto.h>
+
+
+namespace input
+{
+    Buttons buttons;
+    
+    std::uint8_t Buttons::read() noexcept
+    {
+        using PB=Pokitto::Buttons;
+        
+        return (PB::upBtn() ? Up : 0) | (PB::downBtn() ? Down : 0) | (PB::leftBtn() ? Left : 0) | (PB::rightBtn() ? Right : 0) |
+               (PB::aBtn() ? A : 0) | (PB::bBtn() ? B : 0) | (PB::cBtn() ? C : 0);
+    }
+    
+    void Buttons::sample(std::uint8_t state) noexcept
+    {
+        std::uint8_t previous = _history[_head];
+        
+        _head = (_head + 1) % historyLength;
+        _history[_head] = state;
+        for (unsigned i = 0; i < buttonCount; i++)
+        {
+            std::uint8_t bit = 1 << i;
+            
+            if (!(state & bit))
+            {
+                if (previous & bit)
+                    _push(EventType::Released, i);
+                _heldFrames[i] = 0;
+                continue;
+            }
+            if (_heldFrames[i] < 0xFFFF)
+                _heldFrames[i]++;
+            if (!(previous & bit))
+                _push(EventType::Pressed, i);
+            else
+            {
+                auto& repeat = _repeats[i];
+                int sinceDelay = int(_heldFrames[i]) - 1 - repeat.delay;
+                
+                // Saturated hold durations stop repeating rather than drifting.
+                if ((repeat.delay > 0) && (sinceDelay >= 0) && (_heldFrames[i] < 0xFFFF) && (sinceDelay % repeat.interval == 0))
+                    _push(EventType::Repeated, i);
+            }
+        }
+    }
+    
+    std::uint16_t Buttons::heldFrames(Button button) const noexcept
+    {
+        for (unsigned i = 0; i < buttonCount; i++)
+            if (button == (1 << i))
+                return _heldFrames[i];
+        return 0;
+    }
+    
+    void Buttons::setRepeat(std::uint8_t buttons, std::uint8_t delay, std::uint8_t interval) noexcept
+    {
+        for (unsigned i = 0; i < buttonCount; i++)
+            if (buttons & (1 << i))
+                _repeats[i] = {delay, std::uint8_t(interval > 0 ? interval : 1)};
+    }
+    
+    bool Buttons::poll(Event& event) noexcept
+    {
+        if (_eventCount == 0)
+            return false;
+        event = _events[_eventHead];
+        _eventHead = (_eventHead + 1) % queueCapacity;
+        _eventCount--;
+        return true;
+    }
+    
+    void Buttons::_push(EventType type, unsigned index) noexcept
+    {
+        if (_eventCount == queueCapacity)
+        {
+            _eventHead = (_eventHead + 1) % queueCapacity;
+            _eventCount--;
+        }
+        _events[(_eventHead + _eventCount++) % queueCapacity] = {type, Button(1 << index), _heldFrames[index]};
+    }
+}
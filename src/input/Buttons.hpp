@@ -0,0 +1,100 @@
+#ifndef INPUT_BUTTONS_HPP
+#   define INPUT_BUTTONS_HPP
+
+#   include <cstdint>
+
+
+namespace input
+{
+    // A button's bit in a sampled state.
+    enum Button : std::uint8_t
+    {
+        Up = 1 << 0,
+        Down = 1 << 1,
+        Left = 1 << 2,
+        Right = 1 << 3,
+        A = 1 << 4,
+        B = 1 << 5,
+        C = 1 << 6
+    };
+    
+    constexpr unsigned buttonCount = 7;
+    
+    enum class EventType : std::uint8_t
+    {
+        Pressed,
+        Released,
+        // A button held long enough to auto-repeat, see Buttons::setRepeat().
+        Repeated
+    };
+    
+    struct Event
+    {
+        EventType type;
+        Button button;
+        // How many frames the button was held for, including this one.
+        std::uint16_t heldFrames;
+    };
+    
+    // The buttons, sampled once per frame. Scenes read the samples instead of the hardware, so a frame sees a single state.
+    // Edges, hold durations and auto-repeats are also queued as events, for menus to consume at their own pace.
+    class Buttons
+    {
+    public:
+        // Sampled states kept, the current frame's included.
+        static constexpr unsigned historyLength = 8;
+        // Events past this are dropped, the oldest first.
+        static constexpr unsigned queueCapacity = 16;
+        
+        // Reads the hardware's state, as a mask of Buttons.
+        static std::uint8_t read() noexcept;
+        
+        // Feeds the frame's state, once per frame.
+        void sample(std::uint8_t state) noexcept;
+        
+        // The state framesAgo frames ago, 0 being the current frame's.
+        std::uint8_t state(unsigned framesAgo = 0) const noexcept
+        {
+            return _history[(_head + historyLength - framesAgo) % historyLength];
+        }
+        
+        bool held(Button button) const noexcept { return state() & button; }
+        // Whether the button went down or up on this frame.
+        bool pressed(Button button) const noexcept { return state() & ~state(1) & button; }
+        bool released(Button button) const noexcept { return ~state() & state(1) & button; }
+        
+        // How many frames the button has been held for, 0 if it isn't.
+        std::uint16_t heldFrames(Button button) const noexcept;
+        
+        // The given buttons repeat after being held for delay frames, then every interval frames. A delay of 0 disables repeats.
+        void setRepeat(std::uint8_t buttons, std::uint8_t delay, std::uint8_t interval) noexcept;
+        
+        // Pops the oldest event, returning false if there's none.
+        bool poll(Event& event) noexcept;
+        
+        // Forgets every pending event, e.g. when the scene they were for ends.
+        void clearEvents() noexcept { _eventCount = 0; }
+    
+    private:
+        struct Repeat
+        {
+            std::uint8_t delay = 0;
+            std::uint8_t interval = 0;
+        };
+        
+        void _push(EventType type, unsigned index) noexcept;
+        
+        std::uint8_t _history[historyLength] = {};
+        unsigned _head = 0;
+        std::uint16_t _heldFrames[buttonCount] = {};
+        Repeat _repeats[buttonCount];
+        Event _events[queueCapacity];
+        unsigned _eventHead = 0;
+        unsigned _eventCount = 0;
+    };
+    
+    extern Buttons buttons;
+}
+
+
+#endif // INPUT_BUTTONS_HPP
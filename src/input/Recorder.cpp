@@ -0,0 +1,136 @@
+#include "input/Recorder.hpp"
+
+#include <cstdlib>
+#include <cstring>
+
+#ifdef POKITTO
+#   include <SDFileSystem.h>
+#endif
+
+
+namespace input
+{
+    namespace
+    {
+        constexpr char magic[4] = {'P', 'K', 'I', 'R'};
+        
+        std::FILE* open(const char* path, const char* mode) noexcept
+        {
+#ifdef POKITTO
+            // Mounts the SD card as "/sd" on first use.
+            static SDFileSystem sd(P0_9, P0_8, P0_6, P0_7, "sd");
+#endif
+            return std::fopen(path, mode);
+        }
+    }
+    
+    Recorder recorder;
+    
+    bool Recorder::record(const char* path, std::uint32_t seed) noexcept
+    {
+        stop();
+        _file = open(path, "wb");
+        if (!_file)
+            return false;
+        
+        std::uint8_t header[9];
+        
+        std::memcpy(header, magic, 4);
+        header[4] = version;
+        for (int i = 0; i < 4; i++)
+            header[5 + i] = seed >> (i * 8);
+        std::fwrite(header, 1, sizeof(header), _file);
+        std::srand(seed);
+        _recording = true;
+        _runCount = 0;
+        _runLength = 0;
+        _frames = 0;
+        return true;
+    }
+    
+    bool Recorder::replay(const char* path) noexcept
+    {
+        stop();
+        _file = open(path, "rb");
+        if (!_file)
+            return false;
+        
+        std::uint8_t header[9];
+        
+        if ((std::fread(header, 1, sizeof(header), _file) != sizeof(header)) || (std::memcmp(header, magic, 4) != 0) || (header[4] != version))
+        {
+            stop();
+            return false;
+        }
+        
+        std::uint32_t seed = 0;
+        
+        for (int i = 0; i < 4; i++)
+            seed |= std::uint32_t(header[5 + i]) << (i * 8);
+        std::srand(seed);
+        _recording = false;
+        _runLength = 0;
+        _frames = 0;
+        return true;
+    }
+    
+    void Recorder::stop() noexcept
+    {
+        if (!_file)
+            return;
+        if (_recording && (_runLength > 0))
+            _writeRun();
+        flush();
+        std::fclose(_file);
+        _file = nullptr;
+    }
+    
+    void Recorder::flush() noexcept
+    {
+        if (!recording())
+            return;
+        std::fwrite(_runs, 1, _runCount * 2, _file);
+        std::fflush(_file);
+        _runCount = 0;
+    }
+    
+    std::uint8_t Recorder::filter(std::uint8_t state) noexcept
+    {
+        if (!_file)
+            return state;
+        if (_recording)
+        {
+            if ((_runLength > 0) && ((state != _state) || (_runLength == 0xFF)))
+                _writeRun();
+            _state = state;
+            _runLength++;
+        }
+        else
+        {
+            if (_runLength == 0)
+            {
+                std::uint8_t run[2];
+                
+                if ((std::fread(run, 1, 2, _file) != 2) || (run[1] == 0))
+                {
+                    stop();
+                    return state;
+                }
+                _state = run[0];
+                _runLength = run[1];
+            }
+            _runLength--;
+        }
+        _frames++;
+        return _state;
+    }
+    
+    void Recorder::_writeRun() noexcept
+    {
+        _runs[_runCount * 2] = _state;
+        _runs[_runCount * 2 + 1] = _runLength;
+        _runLength = 0;
+        if (++_runCount == bufferedRuns)
+            flush();
+    }
+}
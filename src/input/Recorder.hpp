@@ -0,0 +1,62 @@
+#ifndef INPUT_RECORDER_HPP
+#   define INPUT_RECORDER_HPP
+
+#   include <cstdint>
+#   include <cstdio>
+
+
+namespace input
+{
+    // Records the sampled buttons and the RNG seed to a file, or replays them from one, so that runs can be repeated exactly.
+    // The file starts with "PKIR", a version byte and the seed (LSB first), followed by (state, frame count) byte pairs.
+    // On the Pokitto, paths are on the SD card, e.g. "/sd/perfs.rec".
+    // Recorded runs are buffered in RAM and only written when the buffer is full, on flush() and on stop(), so that recording
+    // doesn't add SD card writes to the frames being measured.
+    class Recorder
+    {
+    public:
+        static constexpr std::uint8_t version = 1;
+        // Runs buffered before they're written. A run lasts up to 255 frames, and only ends when the buttons change.
+        static constexpr unsigned bufferedRuns = 128;
+        
+        // Seeds rand() with the seed and starts recording. Returns false if the file can't be written.
+        bool record(const char* path, std::uint32_t seed) noexcept;
+        
+        // Seeds rand() with the recorded seed and starts replaying. Returns false if the file can't be read or isn't a recording.
+        bool replay(const char* path) noexcept;
+        
+        // Writes what's left to record and closes the file.
+        void stop() noexcept;
+        
+        // Writes the buffered runs, e.g. between scenes, where the write's time doesn't matter.
+        // A Pokitto is usually switched off rather than exited, so this bounds what's lost to the runs since the last flush.
+        void flush() noexcept;
+        
+        // Passes the frame's sampled state through. Records it, or replaces it with the recorded one.
+        // The replay stops at the end of the recording, and the live state goes through again.
+        std::uint8_t filter(std::uint8_t state) noexcept;
+        
+        bool recording() const noexcept { return _file && _recording; }
+        bool replaying() const noexcept { return _file && !_recording; }
+        
+        // Frames recorded or replayed so far.
+        std::uint32_t frames() const noexcept { return _frames; }
+    
+    private:
+        void _writeRun() noexcept;
+        
+        std::FILE* _file = nullptr;
+        // (state, frame count) pairs.
+        std::uint8_t _runs[bufferedRuns * 2];
+        unsigned _runCount = 0;
+        bool _recording = false;
+        std::uint8_t _state = 0;
+        std::uint8_t _runLength = 0;
+        std::uint32_t _frames = 0;
+    };
+    
+    extern Recorder recorder;
+}
+
+
+#endif // INPUT_RECORDER_HPP
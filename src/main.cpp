@@ -2,12 +2,35 @@
 #include <miloslav.h>
 #include <Tilemap.hpp>
 #include <SDFileSystem.h>
-#include "sprites/Mareve.h"
+#include "sprites/MareveSpans.h"
 #include "tilesets/TerminalTileSet.h"
+#include "texts/Dialogues.h"
 #include "maps.h"
+#include "ptui/CellTileMap.hpp"
+#include "ptui/Frames.hpp"
+#include "ptui/ListView.hpp"
+#include "ptui/Menu.hpp"
+#include "ptui/StringTable.hpp"
 #include "ptui/TASTerminalTileMap.hpp"
+#include "ptui/TextStrip.hpp"
+#include "ptui/UTF8.hpp"
+#include "gfx/TASSpriteBatch.hpp"
+#include "input/Buttons.hpp"
+#include "input/Recorder.hpp"
+#include "world/Camera.hpp"
+#include "world/Collision.hpp"
+#include "world/Kinematics.hpp"
+#include "world/MapRegistry.hpp"
+#include "world/Triggers.hpp"
+#include "scene/Arena.hpp"
+#include "scene/FrameScheduler.hpp"
+#include "scene/QualityGovernor.hpp"
+#include "scene/SceneManager.hpp"
 #include <ptui>
 
+static_assert(sizeof(TerminalTileSet) == 128 * ptui::ttmTileWidth * ptui::ttmTileHeight,
+              "The terminal renders TerminalTileSet's 128 glyphs, at ptui::ttmTileWidth x ptui::ttmTileHeight");
+
 int transition = 0;
 bool renderTransparency = true;
 bool renderCLUT = true;
@@ -20,7 +43,7 @@ void GameFiller(std::uint8_t* line, std::uint32_t y, bool skip) noexcept
     bool transitioning = (yMin > (int)y) || ((int)y > yMax);
     
     TAS::BGTileFiller(line, y, skip);
-    TAS::SpriteFiller(line, y, skip || transitioning);
+    gfx::SpriteBatchFiller(line, y, skip || transitioning);
     ptui::TerminalTMFiller(line, y, skip);
     if (transitioning)
         std::fill(line, line + PROJ_LCDWIDTH, 0);
@@ -71,366 +94,512 @@ TAS::LineFiller availableLineFillers[8]
     TerminalTMFiller111,
 };
 
-int battleMockup()
+// The dialogue's proportional text, while the battle mockup plays.
+ptui::TextStrip* dialogue = nullptr;
+
+void DialogueOverlay(std::uint8_t* line, std::uint32_t y, bool skip) noexcept
 {
-    using PC=Pokitto::Core;
-    using PD=Pokitto::Display;
-    using PB=Pokitto::Buttons;
-    
-    auto mareveOriginX = Mareve[0] / 2;
-    auto mareveOriginY = Mareve[1] / 2;
-    Tilemap tilemap;
-    tilemap.set(gardenPath[0], gardenPath[1], gardenPath+2);
+    dialogue->renderIntoLineBuffer(line, y, skip);
+}
+
+// What the overlay fillers composite over the terminal, set by the scene using them.
+TAS::LineFiller uiOverlay = DialogueOverlay;
+
+// The UI fillers, with the overlay composited over the terminal.
+template<unsigned indexP>
+void OverlayFiller(std::uint8_t* line, std::uint32_t y, bool skip) noexcept
+{
+    availableLineFillers[indexP](line, y, skip);
+    uiOverlay(line, y, skip);
+}
+
+TAS::LineFiller overlayLineFillers[8]
+{
+    OverlayFiller<0>,
+    OverlayFiller<1>,
+    OverlayFiller<2>,
+    OverlayFiller<3>,
+    OverlayFiller<4>,
+    OverlayFiller<5>,
+    OverlayFiller<6>,
+    OverlayFiller<7>,
+};
+
+// The UI features the intermission's rendering options enable, as an index into the 8 UI fillers:
+// 4 for transparency, 2 for the CLUT, 1 for the colour offset.
+int uiFeatures() noexcept
+{
+    return (renderTransparency ? 4 : 0) | (renderCLUT ? 2 : 0) | (renderColorOffset ? 1 : 0);
+}
+
+// The UI features the quality governor dropped, in the scene playing. The colour offset is dropped first, then the CLUT,
+// then transparency.
+int droppedUIFeatures() noexcept
+{
+    int features = uiFeatures();
+    int dropped = 0;
+    unsigned level = scene::qualityGovernor.level(2);
     
-    for (int i = 0; i < sizeof(tiles)/(POK_TILE_W*POK_TILE_H); i++)
-        tilemap.setTile(i, POK_TILE_W, POK_TILE_H, tiles+i*POK_TILE_W*POK_TILE_H);
+    for (int feature = 1; (feature <= 4) && (level > 0); feature <<= 1)
+        if (features & feature)
+        {
+            dropped |= feature;
+            level--;
+        }
+    return dropped;
+}
+
+// What the last gameplay scene had dropped when it exited, shown by the intermission.
+int lastDroppedUIFeatures = 0;
 
-    int characterX = 32;
-    int characterY = 32;
-    int speed=1;
-    int ticks = 0;
+// Printing is slow, so it waits for the frame's spare time.
+bool printFPSJob(void*) noexcept
+{
+    int dropped = droppedUIFeatures();
     
-    // Configuration.
-    ptui::tasUITileMap.setTilesetImage(TerminalTileSet);
-    ptui::tasUITileMap.setOffset(-1, -4);
-    ptui::tasUITileMap.setCursorDelta(0);
-    ptui::tasUITileMap.clear();
+    printf("fps=%d%s%s%s\n", Pokitto::Core::fps_counter, (dropped & 4) ? " -Trans" : "", (dropped & 2) ? " -CLUT" : "",
+           (dropped & 1) ? " -COff" : "");
+    return true;
+}
+
+// Returns the UI filler the intermission's rendering options select, out of the given 8 variants.
+// Benchmarks use it, as they measure that exact filler.
+TAS::LineFiller selectUIFillers(const TAS::LineFiller* lineFillers = availableLineFillers) noexcept
+{
+    return lineFillers[uiFeatures()];
+}
+
+// The UI fillers, from the intermission's rendering options down to the cheapest variant the quality governor can fall back to.
+TAS::LineFiller uiFillerVariants[4];
+
+// Returns the best UI filler, out of the given 8 variants, and lets the quality governor fall back to cheaper ones.
+// Gameplay scenes use it, as they'd rather keep their frame rate.
+TAS::LineFiller governUIFillers(const TAS::LineFiller* lineFillers) noexcept
+{
+    int lineFillerIndex = uiFeatures();
+    unsigned count = 0;
     
-    PD::lineFillers[0] = TAS::BGTileFiller;
-    PD::lineFillers[1] = TAS::SpriteFiller;
+    uiFillerVariants[count++] = lineFillers[lineFillerIndex];
+    for (int feature = 1; feature <= 4; feature <<= 1)
+        if (lineFillerIndex & feature)
+        {
+            lineFillerIndex &= ~feature;
+            uiFillerVariants[count++] = lineFillers[lineFillerIndex];
+        }
+    scene::qualityGovernor.setVariants(2, uiFillerVariants, count);
+    return uiFillerVariants[0];
+}
+
+// The character's walk and run, in fixed point pixels per frame.
+constexpr world::Motion walkMotion{world::fixedOne / 4, world::fixedOne / 2, world::fixedOne * 3 / 2};
+constexpr world::Motion runMotion{world::fixedOne / 2, world::fixedOne / 2, world::fixedOne * 4};
+
+// The battle mockup's commands, and their targets, in boxes shadowed with the disabled items' dimmed colours.
+constexpr ptui::FrameStyle battleMenuFrame = ptui::shadowed(ptui::boxFrame, 32);
+const ptui::MenuItem targetItems[] = {{"Rat"}, {"Slime"}};
+const ptui::MenuPage targetMenu{targetItems, 2, 9, 20, 6, 2};
+const ptui::MenuItem battleItems[] = {{"Attack", &targetMenu}, {"Magick", &targetMenu}, {"Items", nullptr, true}};
+const ptui::MenuPage battleMenu{battleItems, 3, 2, 20, 7, 7};
+
+class BattleMockup : public scene::Scene
+{
+public:
+    bool preload(unsigned step) noexcept override;
+    void enter() noexcept override;
+    bool update() noexcept override;
+    void exit() noexcept override;
+
+private:
+    static bool drawPartyJob(void* self) noexcept;
+    void _drawParty() noexcept;
     
-    // Drawing the UI.
-    while (PC::isRunning() && !PB::cBtn())
+    // Only allocated while the scene plays.
+    Tilemap* _tilemap;
+    world::MapHandle _map;
+    world::Body _character;
+    world::Camera _camera;
+    ptui::Menu _menu;
+    int _ticks;
+};
+
+bool BattleMockup::preload(unsigned step) noexcept
+{
+    switch (step)
     {
-        if (!PC::update()) 
-            continue;
-        
-        {
-            int oldX = characterX;
-            int oldY = characterY;
+    case 0:
+        ptui::tasUITileMap.setTilesetImage(TerminalTileSet);
+        ptui::tasUITileMap.setOffset(-1, -4);
+        ptui::tasUITileMap.setCursorDelta(0);
+        ptui::tasUITileMap.clear();
+        return false;
     
-            if (PB::aBtn())
-            {
-                auto offsetX = ptui::tasUITileMap.offsetX();
-                auto offsetY = ptui::tasUITileMap.offsetY();
-        
-                if (PB::leftBtn()) offsetX--;
-                if (PB::rightBtn()) offsetX++;
-                if (PB::downBtn()) offsetY++;
-                if (PB::upBtn()) offsetY--;
-                ptui::tasUITileMap.setOffset(offsetX, offsetY);
-            }
-            else
-            {
-                speed = PB::bBtn() ? 4 : 1;
-                while (speed--)
-                {
-                    {
-                        if (PB::leftBtn()) characterX--;
-                        if (PB::rightBtn()) characterX++;
-                        
-                        int tileX = characterX / PROJ_TILE_W;
-                        int tileY = characterY / PROJ_TILE_H;
-                        auto tile = gardenPathEnum(tileX, tileY);
-                        if (tile == Collide)
-                            characterX = oldX;
-                    }
-                    {
-                        if (PB::downBtn()) characterY++;
-                        if (PB::upBtn()) characterY--;
-                        
-                        int tileX = characterX / PROJ_TILE_W;
-                        int tileY = characterY / PROJ_TILE_H;
-                        auto tile = gardenPathEnum(tileX, tileY);
-                        if (tile == Collide)
-                            characterY = oldY;
-                    }
-                }
-            }
-        }
-        ptui::tasUITileMap.setCursor(1, 1);
-        ptui::tasUITileMap.fillRectTiles(1, 1, 3, 1, 0);
-        ptui::tasUITileMap.printInteger(PC::fps_counter);
-        
-        
-        if ((ticks >= 60) && (ticks <= 120))
+    default:
+        // Half of the character's collision box is 4 pixels.
+        _character = {world::toFixed(32), world::toFixed(32), 0, 0, 4, 4};
+        _camera.snap(_character.pixelX(), _character.pixelY());
+        _ticks = 0;
+        // Never null: they're the scene's only allocations.
+        static_assert(scene::Arena::footprint<Tilemap, ptui::TextStrip>() <= scene::Arena::capacity,
+                      "The battle mockup's Tilemap and TextStrip outgrew the scene arena");
+        _tilemap = scene::sceneArena.make<Tilemap>();
+        dialogue = scene::sceneArena.make<ptui::TextStrip>();
+        dialogue->setTilesetImage(TerminalTileSet, sizeof(TerminalTileSet) / (ptui::ttmTileWidth * ptui::ttmTileHeight));
+        // The terminal's blue text.
+        dialogue->setColors(136 + 6, 136 + 5, 3);
+        // Red for the selection, dimmed for disabled items.
+        _menu.setDeltas(0, 8, 32);
+        _menu.setFrame(battleMenuFrame);
+        // Builds defining MAPS_EXCLUDE_gardenPath play the scene without a map: nothing to draw, collide with or trigger.
+        _map = world::MapRegistry::find("gardenPath");
+        if (_map.valid())
         {
-            bool attackIsSelected = (ticks < 70) || (ticks >= 80);
-            bool magickIsSelected = !attackIsSelected;
-            bool itemsIsSelected = false;
-                
-            ptui::tasUITileMap.drawBox(2, 20, 10, 28);
-            
-            ptui::tasUITileMap.setCursor(3, 21);
-            ptui::tasUITileMap.setCursorDelta(attackIsSelected ? 8 : 0);
-            ptui::tasUITileMap.printChar(attackIsSelected ? '>' : ' ');
-            ptui::tasUITileMap.printString("Attack");
-            
-            ptui::tasUITileMap.setCursor(3, 22);
-            ptui::tasUITileMap.setCursorDelta(magickIsSelected ? 8 : 0);
-            ptui::tasUITileMap.printChar(magickIsSelected ? '>' : ' ');
-            ptui::tasUITileMap.printString("Magick");
-            
-            ptui::tasUITileMap.setCursor(3, 23);
-            ptui::tasUITileMap.setCursorDelta(itemsIsSelected ? 8 : 0);
-            ptui::tasUITileMap.printChar(itemsIsSelected ? '>' : ' ');
-            ptui::tasUITileMap.printString("Items");
-            if (ticks < 70)
-            {
-                ptui::tasUITileMap.setTileAndDelta(3, 21, '>', 8);
-            }
-            else if (ticks < 80)
-            {
-                ptui::tasUITileMap.setTileAndDelta(3, 21, ' ', 0);
-                ptui::tasUITileMap.setTileAndDelta(3, 22, '>', 8);
-            }
-            else if (ticks < 90)
-            {
-                ptui::tasUITileMap.setTileAndDelta(3, 21, '>', 8);
-                ptui::tasUITileMap.setTileAndDelta(3, 22, ' ', 0);
-            }
-            else
-            {
-                bool ratIsSelected = (ticks < 105);
-                bool slimeIsSelected = !ratIsSelected;
-                
-                ptui::tasUITileMap.fillRectDeltas(9, 20, 16, 23, 0);
-                ptui::tasUITileMap.drawBox(9, 20, 16, 23);
-                
-                ptui::tasUITileMap.setCursorDelta(ratIsSelected ? 8 : 0);
-                ptui::tasUITileMap.setCursor(10, 21);
-                ptui::tasUITileMap.printChar(ratIsSelected ? '>' : ' ');
-                ptui::tasUITileMap.printString("Rat");
-                
-                ptui::tasUITileMap.setCursorDelta(slimeIsSelected ? 8 : 0);
-                ptui::tasUITileMap.setCursor(10, 22);
-                ptui::tasUITileMap.printChar(slimeIsSelected ? '>' : ' ');
-                ptui::tasUITileMap.printString("Slime");
-                
-                ptui::tasUITileMap.setCursorDelta(0);
-            }
-        }
-        else
-        {
-            ptui::tasUITileMap.fillRectTilesAndDeltas(-1, 20, 37, 30, 0, 0);
-            
-            ptui::tasUITileMap.drawBox(-1, 21, 37, 30);
-            
-            ptui::tasUITileMap.setCursor(17, 22);
-            ptui::tasUITileMap.printString("Mareve");
-            
-            ptui::tasUITileMap.setCursor(26, 22);
-            ptui::tasUITileMap.printInteger(133, 4);
-            
-            ptui::tasUITileMap.drawGauge(31, 35, 22, ticks, 59);
-            
-            ptui::tasUITileMap.setCursor(17, 24);
-            ptui::tasUITileMap.printString("Delirio");
-            
-            ptui::tasUITileMap.setCursor(26, 24);
-            ptui::tasUITileMap.printInteger(6894, 4);
-            
-            ptui::tasUITileMap.drawGauge(31, 35, 24, ticks, 59);
-            
-            ptui::tasUITileMap.setCursor(17, 26);
-            ptui::tasUITileMap.printString("Matti");
-            
-            ptui::tasUITileMap.setCursor(26, 26);
-            ptui::tasUITileMap.printInteger(9999, 4);
-            
-            ptui::tasUITileMap.drawGauge(31, 35, 26, ticks, 59);
-            
-            ptui::tasUITileMap.setCursor(17, 28);
-            ptui::tasUITileMap.printString("???");
-            
-            ptui::tasUITileMap.setCursor(26, 28);
-            ptui::tasUITileMap.printInteger(543, 4);
-            
-            ptui::tasUITileMap.drawGauge(31, 35, 28, ticks, 59);
-            
-            ptui::tasUITileMap.fillRectDeltas(31, 22, 35, 28, ticks >= 59 ? 8 : 0);
-        }
-        if (ticks > 120)
-        {
-            ptui::tasUITileMap.drawGauge(31, 35, 22, 0, 59);
-            ptui::tasUITileMap.drawGauge(31, 35, 24, 0, 59);
-            ptui::tasUITileMap.drawGauge(31, 35, 26, 0, 59);
-            ptui::tasUITileMap.drawGauge(31, 35, 28, 0, 59);
+            world::mapRegistry.enter(_map, *_tilemap, _character.pixelX(), _character.pixelY());
+            // Registers the tiles and decodes the window now, rather than on the first frame.
+            world::mapRegistry.streamer();
         }
+        return true;
+    }
+}
 
-        if (ticks > 16)
-        {
-            ptui::tasUITileMap.drawBox(2, 2, 35, 6);
-            
-            ptui::tasUITileMap.setCursorBoundingBox(3, 3, 34, 5);
-            ptui::tasUITileMap.setCursor(3, 3);
-            
-            ptui::tasUITileMap.setCursorDelta(16);
-            ptui::tasUITileMap.printString("Life... dreams... hope...\n    \n\nWhere do they come from?\nAnd where do they go?\n     \n\nSuch meaningless things...\nI'll destroy them all!    ", (ticks - 16) / 2);
-            ptui::tasUITileMap.setCursorDelta(0);
+void BattleMockup::enter() noexcept
+{
+    fillers[0] = TAS::BGTileFiller;
+    fillers[1] = gfx::SpriteBatchFiller;
+    uiOverlay = DialogueOverlay;
+    fillers[2] = governUIFillers(overlayLineFillers);
+}
 
-            ptui::tasUITileMap.resetCursorBoundingBox();
+bool BattleMockup::update() noexcept
+{
+    using PC=Pokitto::Core;
+    const auto& buttons = input::buttons;
+    
+    auto mareveOriginX = MareveSpans[0] / 2;
+    auto mareveOriginY = MareveSpans[1] / 2;
+    
+    {
+        int directionX = 0;
+        int directionY = 0;
+        
+        if (buttons.held(input::A))
+        {
+            auto offsetX = ptui::tasUITileMap.offsetX();
+            auto offsetY = ptui::tasUITileMap.offsetY();
+    
+            if (buttons.held(input::Left)) offsetX--;
+            if (buttons.held(input::Right)) offsetX++;
+            if (buttons.held(input::Down)) offsetY++;
+            if (buttons.held(input::Up)) offsetY--;
+            ptui::tasUITileMap.setOffset(offsetX, offsetY);
         }
         else
-            ptui::tasUITileMap.fillRectTiles(2, 2, 35, 6, 0);
-    
         {
-            ptui::tasUITileMap.drawGauge(1, 35, 8, ticks, 350);
-            ptui::tasUITileMap.fillRectDeltas(1, 8, 35, 9, (ticks / 16 % 2) ? 40 : 0);
-            ptui::tasUITileMap.setCursorBoundingBox(1, 9, 35, 9);
-            ptui::tasUITileMap.setCursor(1, 9);
-            ptui::tasUITileMap.setCursorDelta((ticks / 16 % 2) ? 40 : 0);
-            ptui::tasUITileMap.printText("This is an interesting text!");
-            ptui::tasUITileMap.resetCursorBoundingBox();
-            ptui::tasUITileMap.setCursorDelta(0);
+            directionX = (buttons.held(input::Right) ? 1 : 0) - (buttons.held(input::Left) ? 1 : 0);
+            directionY = (buttons.held(input::Down) ? 1 : 0) - (buttons.held(input::Up) ? 1 : 0);
         }
         
-        PD::drawSprite(110 - mareveOriginX, 88 - mareveOriginY, Mareve);
-        tilemap.draw(-(characterX - 110), -(characterY - 88));
-        ticks++;
-        if (ticks == 350)
+        // The character coasts to a stop when not steered, even while the UI is being moved.
+        auto move = world::move(world::mapRegistry.streamer(), _character, directionX, directionY,
+                                buttons.held(input::B) ? runMotion : walkMotion, Collide);
+        int characterX = _character.pixelX();
+        int characterY = _character.pixelY();
+        // Walking into an exit leaves the scene.
+        if (_map.valid())
         {
-            printf("fps=%d\n", PC::fps_counter);
-            ticks = 0;
+            auto triggers = world::triggersBetween(_map.triggers(), characterX - move.dx, characterY - move.dy, characterX, characterY);
+            
+            if (triggers.entersEvent(GoToTitle))
+                return false;
         }
-        transition++;
+        _camera.follow(characterX, characterY);
     }
+    ptui::tasUITileMap.setCursor(1, 1);
+    ptui::tasUITileMap.fillRectTiles(1, 1, 3, 1, 0);
+    ptui::tasUITileMap.printInteger(PC::fps_counter);
     
-    return 0;
+    
+    // The menu plays a scripted selection, and only redraws what changed.
+    if (_ticks == 60)
+        _menu.open(ptui::tasUITileMap, battleMenu);
+    else if ((_ticks == 70) || (_ticks == 80))
+        _menu.select(_ticks == 70 ? 1 : 0);
+    else if (_ticks == 90)
+        _menu.choose();
+    else if (_ticks == 105)
+        _menu.select(1);
+    else if (_ticks == 121)
+        _menu.close();
+    
+    // The party's panel is under the menu.
+    if (!_menu.isOpen())
+        scene::frameScheduler.post(drawPartyJob, this);
+    
+    // The dialogue's box stays in the tile map between frames, so it's only stamped and erased once.
+    if (_ticks == 17)
+        ptui::stampFrame(ptui::tasUITileMap, ptui::panelFrame, 2, 2, 35, 6);
+    else if (_ticks == 0)
+        ptui::tasUITileMap.fillRectTiles(2, 2, 35, 6, 0);
+    // Only new characters are rendered into the strip.
+    if (_ticks > 16)
+        dialogue->print(ptui::StringReader(Dialogues, DialoguesId::villainMonologue), (_ticks - 16) / 2);
+    else
+        dialogue->clear();
+    // Inside the dialogue box's borders, following the terminal when it's moved.
+    dialogue->setArea(ptui::tasUITileMap.offsetX() + 3 * ptui::ttmTileWidth, ptui::tasUITileMap.offsetY() + 3 * ptui::ttmTileHeight,
+                      32 * ptui::ttmTileWidth, 3);
+    
+    {
+        ptui::tasUITileMap.drawGauge(1, 35, 8, _ticks, 350);
+        ptui::tasUITileMap.fillRectDeltas(1, 8, 35, 9, (_ticks / 16 % 2) ? 40 : 0);
+        ptui::tasUITileMap.setCursorBoundingBox(1, 9, 35, 9);
+        ptui::tasUITileMap.setCursor(1, 9);
+        ptui::tasUITileMap.setCursorDelta((_ticks / 16 % 2) ? 40 : 0);
+        ptui::tasUITileMap.printText("This is an interesting text!");
+        ptui::tasUITileMap.resetCursorBoundingBox();
+        ptui::tasUITileMap.setCursorDelta(0);
+    }
+    
+    gfx::tasSpriteBatch.drawSpans(_character.pixelX() - _camera.left() - mareveOriginX, _character.pixelY() - _camera.top() - mareveOriginY, MareveSpans);
+    if (_map.valid())
+    {
+        world::mapRegistry.streamer().update(_character.pixelX(), _character.pixelY());
+        world::mapRegistry.streamer().draw(*_tilemap, _camera.left(), _camera.top());
+    }
+    _ticks++;
+    if (_ticks == 350)
+    {
+        scene::frameScheduler.post(printFPSJob, nullptr);
+        _ticks = 0;
+    }
+    transition++;
+    
+    return !buttons.held(input::C);
 }
 
-int testPerfsFull(bool cropped)
+bool BattleMockup::drawPartyJob(void* self) noexcept
 {
-    using PC=Pokitto::Core;
-    using PD=Pokitto::Display;
-    using PB=Pokitto::Buttons;
+    static_cast<BattleMockup*>(self)->_drawParty();
+    return true;
+}
+
+void BattleMockup::_drawParty() noexcept
+{
+    // The menu took the panel's place since the job was posted.
+    if (_menu.isOpen())
+        return;
     
-    int ticks = 0;
+    ptui::tasUITileMap.fillRectTilesAndDeltas(-1, 20, 37, 20, 0, 0);
+    ptui::stampFrame(ptui::tasUITileMap, ptui::panelFrame, -1, 21, 37, 30);
     
-    // Configuration.
-    ptui::tasUITileMap.setTilesetImage(TerminalTileSet);
-    ptui::tasUITileMap.clear(32);
-    ptui::tasUITileMap.setOffset(-1, cropped ? 135: 0);
-    ptui::tasUITileMap.setCursorDelta(0);
+    ptui::tasUITileMap.setCursor(17, 22);
+    ptui::tasUITileMap.printString("Mareve");
     
-    ptui::tasUITileMap.drawBox(1, 1, 35, 28);
-    ptui::tasUITileMap.setCursor(2, 2);
-    ptui::tasUITileMap.setCursorBoundingBox(2, 2, 34, 27);
-    ptui::tasUITileMap.fillRectDeltas(2, 2, 6, 2, 8);
-    ptui::tasUITileMap.printText("Hello my good chap! Are we ready for the Punk Jam yet?!");
-    ptui::tasUITileMap.resetCursorBoundingBox();
+    ptui::tasUITileMap.setCursor(26, 22);
+    ptui::tasUITileMap.printInteger(133, 4);
+    
+    ptui::tasUITileMap.drawGauge(31, 35, 22, _ticks, 59);
+    
+    ptui::tasUITileMap.setCursor(17, 24);
+    ptui::tasUITileMap.printString("Delirio");
+    
+    ptui::tasUITileMap.setCursor(26, 24);
+    ptui::tasUITileMap.printInteger(6894, 4);
+    
+    ptui::tasUITileMap.drawGauge(31, 35, 24, _ticks, 59);
     
-    ptui::tasUITileMap.drawGauge(2, 6, 4, 3, 6);
-    ptui::tasUITileMap.fillRectDeltas(2, 4, 6, 4, 8);
+    ptui::tasUITileMap.setCursor(17, 26);
+    ptui::tasUITileMap.printString("Matti");
     
+    ptui::tasUITileMap.setCursor(26, 26);
+    ptui::tasUITileMap.printInteger(9999, 4);
     
-    ptui::tasUITileMap.drawGauge(12, 16, 4, 3, 6);
-    ptui::tasUITileMap.fillRectDeltas(12, 4, 16, 4, 16);
+    ptui::tasUITileMap.drawGauge(31, 35, 26, _ticks, 59);
     
-    ptui::tasUITileMap.drawGauge(22, 26, 4, 3, 6);
-    ptui::tasUITileMap.fillRectDeltas(22, 4, 26, 4, 24);
+    ptui::tasUITileMap.setCursor(17, 28);
+    ptui::tasUITileMap.printString("???");
     
-    ptui::tasUITileMap.drawGauge(22, 29, 6, 6, 6);
-    ptui::tasUITileMap.fillRectDeltas(22, 6, 24, 6, 8);
-    ptui::tasUITileMap.fillRectDeltas(25, 6, 26, 6, 32);
-    ptui::tasUITileMap.fillRectDeltas(27, 6, 29, 6, 16);
+    ptui::tasUITileMap.setCursor(26, 28);
+    ptui::tasUITileMap.printInteger(543, 4);
     
-    PD::lineFillers[0] = TAS::NOPFiller;
-    PD::lineFillers[1] = TAS::NOPFiller;
+    ptui::tasUITileMap.drawGauge(31, 35, 28, _ticks, 59);
     
-    // Drawing the UI.
-    while (PC::isRunning() && !PB::cBtn())
+    ptui::tasUITileMap.fillRectDeltas(31, 22, 35, 28, _ticks >= 59 ? 8 : 0);
+    
+    if (_ticks > 120)
     {
-        if (!PC::update()) 
-            continue;
-        
-        if (PB::aBtn())
-        {
-            auto offsetX = ptui::tasUITileMap.offsetX();
-            auto offsetY = ptui::tasUITileMap.offsetY();
+        ptui::tasUITileMap.drawGauge(31, 35, 22, 0, 59);
+        ptui::tasUITileMap.drawGauge(31, 35, 24, 0, 59);
+        ptui::tasUITileMap.drawGauge(31, 35, 26, 0, 59);
+        ptui::tasUITileMap.drawGauge(31, 35, 28, 0, 59);
+    }
+}
+
+void BattleMockup::exit() noexcept
+{
+    lastDroppedUIFeatures = droppedUIFeatures();
+    _menu.close();
+    world::mapRegistry.release();
+    dialogue = nullptr;
+}
+
+class PerfsFullTest : public scene::Scene
+{
+public:
+    explicit PerfsFullTest(bool cropped) noexcept : _cropped(cropped) {}
     
-            if (PB::leftBtn()) offsetX--;
-            if (PB::rightBtn()) offsetX++;
-            if (PB::downBtn()) offsetY++;
-            if (PB::upBtn()) offsetY--;
-            ptui::tasUITileMap.setOffset(offsetX, offsetY);
-        }
+    bool preload(unsigned step) noexcept override;
+    void enter() noexcept override;
+    bool update() noexcept override;
+
+private:
+    bool _cropped;
+    int _ticks;
+};
+
+bool PerfsFullTest::preload(unsigned step) noexcept
+{
+    switch (step)
+    {
+    case 0:
+        _ticks = 0;
+        ptui::tasUITileMap.setTilesetImage(TerminalTileSet);
+        ptui::tasUITileMap.clear(32);
+        ptui::tasUITileMap.setOffset(-1, _cropped ? 135: 0);
+        ptui::tasUITileMap.setCursorDelta(0);
+        return false;
+    
+    case 1:
+        ptui::stampFrame(ptui::tasUITileMap, ptui::boxFrame, 1, 1, 35, 28);
+        ptui::tasUITileMap.setCursor(2, 2);
+        ptui::tasUITileMap.setCursorBoundingBox(2, 2, 34, 27);
+        ptui::tasUITileMap.fillRectDeltas(2, 2, 6, 2, 8);
+        ptui::printString(ptui::tasUITileMap, ptui::asciiGlyphs, ptui::StringReader(Dialogues, DialoguesId::greeting), true);
+        ptui::tasUITileMap.resetCursorBoundingBox();
+        return false;
+    
+    default:
+        ptui::tasUITileMap.drawGauge(2, 6, 4, 3, 6);
+        ptui::tasUITileMap.fillRectDeltas(2, 4, 6, 4, 8);
         
-        ticks++;
-        if (ticks == 60)
-        {
-            printf("fps=%d\n", PC::fps_counter);
-            ticks = 0;
-            ptui::tasUITileMap.setCursor(2, 5);
-            ptui::tasUITileMap.fillRectTiles(2, 5, 3, 5, 0);
-            ptui::tasUITileMap.printInteger(PC::fps_counter);
-        }
-        ptui::tasUITileMap.mapColor(0+5, ticks);
-        ptui::tasUITileMap.mapColor(0+6, ticks + 1);
+        ptui::tasUITileMap.drawGauge(12, 16, 4, 3, 6);
+        ptui::tasUITileMap.fillRectDeltas(12, 4, 16, 4, 16);
+        
+        ptui::tasUITileMap.drawGauge(22, 26, 4, 3, 6);
+        ptui::tasUITileMap.fillRectDeltas(22, 4, 26, 4, 24);
+        
+        ptui::tasUITileMap.drawGauge(22, 29, 6, 6, 6);
+        ptui::tasUITileMap.fillRectDeltas(22, 6, 24, 6, 8);
+        ptui::tasUITileMap.fillRectDeltas(25, 6, 26, 6, 32);
+        ptui::tasUITileMap.fillRectDeltas(27, 6, 29, 6, 16);
+        return true;
     }
-    
-    return 0;
 }
 
-int testPerfsStairs()
+void PerfsFullTest::enter() noexcept
+{
+    fillers[2] = selectUIFillers();
+}
+
+bool PerfsFullTest::update() noexcept
 {
     using PC=Pokitto::Core;
-    using PD=Pokitto::Display;
-    using PB=Pokitto::Buttons;
+    const auto& buttons = input::buttons;
+    
     
-    int ticks = 0;
+    if (buttons.held(input::A))
+    {
+        auto offsetX = ptui::tasUITileMap.offsetX();
+        auto offsetY = ptui::tasUITileMap.offsetY();
+        
+        if (buttons.held(input::Left)) offsetX--;
+        if (buttons.held(input::Right)) offsetX++;
+        if (buttons.held(input::Down)) offsetY++;
+        if (buttons.held(input::Up)) offsetY--;
+        ptui::tasUITileMap.setOffset(offsetX, offsetY);
+    }
     
-    // Configuration.
+    _ticks++;
+    if (_ticks == 60)
+    {
+        scene::frameScheduler.post(printFPSJob, nullptr);
+        _ticks = 0;
+        ptui::tasUITileMap.setCursor(2, 5);
+        ptui::tasUITileMap.fillRectTiles(2, 5, 3, 5, 0);
+        ptui::tasUITileMap.printInteger(PC::fps_counter);
+    }
+    ptui::tasUITileMap.mapColor(0+5, _ticks);
+    ptui::tasUITileMap.mapColor(0+6, _ticks + 1);
+    
+    return !buttons.held(input::C);
+}
+
+class PerfsStairsTest : public scene::Scene
+{
+public:
+    bool preload(unsigned step) noexcept override;
+    void enter() noexcept override;
+    bool update() noexcept override;
+
+private:
+    int _ticks;
+};
+
+bool PerfsStairsTest::preload(unsigned) noexcept
+{
+    _ticks = 0;
     ptui::tasUITileMap.setTilesetImage(TerminalTileSet);
     ptui::tasUITileMap.clear();
     ptui::tasUITileMap.setOffset(0, 0);
     ptui::tasUITileMap.setCursorDelta(0);
+    return true;
+}
+
+void PerfsStairsTest::enter() noexcept
+{
+    fillers[2] = selectUIFillers();
+}
+
+bool PerfsStairsTest::update() noexcept
+{
+    using PC=Pokitto::Core;
+    const auto& buttons = input::buttons;
     
-    PD::lineFillers[0] = TAS::NOPFiller;
-    PD::lineFillers[1] = TAS::NOPFiller;
     
-    // Drawing the UI.
-    while (PC::isRunning() && !PB::cBtn())
+    if (buttons.held(input::A))
     {
-        if (!PC::update()) 
-            continue;
+        auto offsetX = ptui::tasUITileMap.offsetX();
+        auto offsetY = ptui::tasUITileMap.offsetY();
         
-        if (PB::aBtn())
-        {
-            auto offsetX = ptui::tasUITileMap.offsetX();
-            auto offsetY = ptui::tasUITileMap.offsetY();
+        if (buttons.held(input::Left)) offsetX--;
+        if (buttons.held(input::Right)) offsetX++;
+        if (buttons.held(input::Down)) offsetY++;
+        if (buttons.held(input::Up)) offsetY--;
+        ptui::tasUITileMap.setOffset(offsetX, offsetY);
+    }
     
-            if (PB::leftBtn()) offsetX--;
-            if (PB::rightBtn()) offsetX++;
-            if (PB::downBtn()) offsetY++;
-            if (PB::upBtn()) offsetY--;
-            ptui::tasUITileMap.setOffset(offsetX, offsetY);
-        }
-        
-        ticks++;
-        if (ticks == 60)
+    _ticks++;
+    if (_ticks == 60)
+    {
+        scene::frameScheduler.post(printFPSJob, nullptr);
+        _ticks = 0;
+        ptui::tasUITileMap.clear();
+        for (int i = 0; i < 30; i++)
         {
-            printf("fps=%d\n", PC::fps_counter);
-            ticks = 0;
-            ptui::tasUITileMap.clear();
-            for (int i = 0; i < 30; i++)
-            {
-                ptui::tasUITileMap.setCursor(i, i);
-                ptui::tasUITileMap.fillRectTiles(i, i, i+2, i, 32);
-                ptui::tasUITileMap.printInteger(PC::fps_counter);
-            }
+            ptui::tasUITileMap.setCursor(i, i);
+            ptui::tasUITileMap.fillRectTiles(i, i, i+2, i, 32);
+            ptui::tasUITileMap.printInteger(PC::fps_counter);
         }
-        ptui::tasUITileMap.mapColor(0+5, ticks);
-        ptui::tasUITileMap.mapColor(0+6, ticks + 1);
     }
+    ptui::tasUITileMap.mapColor(0+5, _ticks);
+    ptui::tasUITileMap.mapColor(0+6, _ticks + 1);
     
-    return 0;
+    return !buttons.held(input::C);
 }
 
 const char* words[46] =
 {
     "a", "ka", "sa", "ta", "na", "ha", "ma", "ya", "ra", "wa",
-    "i", "ki", "shi","chi","ni", "hi", "mi",       "ri", 
+    "i", "ki", "shi","chi","ni", "hi", "mi",       "ri",
     "u", "ku", "su", "tsu","nu", "fu", "mu", "yu", "ru",
     "e", "ke", "se", "te", "ne", "he", "me",       "re",
     "o", "ko", "so", "to", "no", "ho", "mo", "yo", "ro", "wo",
@@ -441,62 +610,331 @@ const char* poncts[5] =
     ", ", "; ", "! ", ". ", "- "
 };
 
-int testRandomWords()
+// Encoded at compile time, which fails if the terminal's remap gives a character a control code's tile.
+constexpr auto romajiTitle = ptui::encode(ptui::asciiGlyphs, u8"Romaji");
+
+class RandomWordsTest : public scene::Scene
 {
-    using PC=Pokitto::Core;
-    using PD=Pokitto::Display;
-    using PB=Pokitto::Buttons;
-    
-    int ticks = 0;
-    
-    // Configuration.
+public:
+    bool preload(unsigned step) noexcept override;
+    void enter() noexcept override;
+    bool update() noexcept override;
+
+private:
+    int _ticks;
+};
+
+bool RandomWordsTest::preload(unsigned) noexcept
+{
+    _ticks = 0;
     ptui::tasUITileMap.setTilesetImage(TerminalTileSet);
     ptui::tasUITileMap.clear(32, 0);
     ptui::tasUITileMap.setOffset(0, 0);
     ptui::tasUITileMap.setCursorDelta(0);
+    ptui::stampFrame(ptui::tasUITileMap, ptui::boxFrame, 1, 1, 35, 28);
+    ptui::tasUITileMap.setCursor(3, 1);
+    ptui::tasUITileMap.printString(romajiTitle);
     ptui::tasUITileMap.setCursor(2, 2);
-    ptui::tasUITileMap.drawBox(1, 1, 35, 28);
     ptui::tasUITileMap.setCursorBoundingBox(2, 2, 34, 27);
+    return true;
+}
+
+void RandomWordsTest::enter() noexcept
+{
+    fillers[2] = selectUIFillers();
+}
+
+bool RandomWordsTest::update() noexcept
+{
+    const auto& buttons = input::buttons;
     
-    PD::lineFillers[0] = TAS::NOPFiller;
-    PD::lineFillers[1] = TAS::NOPFiller;
     
-    // Drawing the UI.
-    while (PC::isRunning() && !PB::cBtn())
+    if (buttons.held(input::A))
     {
-        if (!PC::update()) 
-            continue;
+        auto offsetX = ptui::tasUITileMap.offsetX();
+        auto offsetY = ptui::tasUITileMap.offsetY();
         
-        if (PB::aBtn())
-        {
-            auto offsetX = ptui::tasUITileMap.offsetX();
-            auto offsetY = ptui::tasUITileMap.offsetY();
+        if (buttons.held(input::Left)) offsetX--;
+        if (buttons.held(input::Right)) offsetX++;
+        if (buttons.held(input::Down)) offsetY++;
+        if (buttons.held(input::Up)) offsetY--;
+        ptui::tasUITileMap.setOffset(offsetX, offsetY);
+    }
     
-            if (PB::leftBtn()) offsetX--;
-            if (PB::rightBtn()) offsetX++;
-            if (PB::downBtn()) offsetY++;
-            if (PB::upBtn()) offsetY--;
-            ptui::tasUITileMap.setOffset(offsetX, offsetY);
-        }
-        
-        ticks++;
-        if (ticks % 2 == 0)
+    _ticks++;
+    if (_ticks % 2 == 0)
+    {
+        ptui::tasUITileMap.setCursorDelta((rand() % 8) * 8);
+        // Through the UTF-8 path, to measure its lookups against plain printText().
+        for (auto syllables = 1 + rand() % 8; syllables > 0; syllables--)
+            ptui::printUTF8(ptui::tasUITileMap, ptui::asciiGlyphs, words[rand() % 46], true);
+        ptui::tasUITileMap.printString(poncts[rand() % 5]);
+    }
+    if (_ticks == 60)
+    {
+        scene::frameScheduler.post(printFPSJob, nullptr);
+        _ticks = 0;
+    }
+    
+    return !buttons.held(input::C);
+}
+
+using InventoryList = ptui::ListView<33, 26>;
+
+// The inventory test's list, while it plays.
+InventoryList* inventoryList = nullptr;
+
+void InventoryOverlay(std::uint8_t* line, std::uint32_t y, bool skip) noexcept
+{
+    inventoryList->renderIntoLineBuffer(line, y, skip);
+}
+
+// Scrolls a long list, on its own until Up or Down move the selection.
+class InventoryTest : public scene::Scene
+{
+public:
+    bool preload(unsigned step) noexcept override;
+    void enter() noexcept override;
+    bool update() noexcept override;
+    void exit() noexcept override;
+
+private:
+    static constexpr unsigned itemCount = 500;
+    
+    static std::uint8_t describeItem(void* self, unsigned index, char* tiles, unsigned columns) noexcept;
+    std::uint8_t _styleOf(unsigned index) const noexcept;
+    void _select(unsigned index) noexcept;
+    
+    unsigned _selected;
+    // In pixels per frame, 0 once the selection moved.
+    int _autoScroll;
+    int _ticks;
+};
+
+bool InventoryTest::preload(unsigned step) noexcept
+{
+    switch (step)
+    {
+    case 0:
+        _ticks = 0;
+        ptui::tasUITileMap.setTilesetImage(TerminalTileSet);
+        ptui::tasUITileMap.clear(32, 0);
+        ptui::tasUITileMap.setOffset(0, 0);
+        ptui::tasUITileMap.setCursorDelta(0);
+        ptui::stampFrame(ptui::tasUITileMap, ptui::boxFrame, 1, 1, 35, 28);
+        ptui::tasUITileMap.setCursor(3, 1);
+        ptui::tasUITileMap.printString("Inventory");
+        return false;
+    
+    default:
+        _selected = 0;
+        _autoScroll = 2;
+        // Never null: it's the scene's only allocation.
+        static_assert(scene::Arena::footprint<InventoryList>() <= scene::Arena::capacity, "The inventory's list outgrew the scene arena");
+        inventoryList = scene::sceneArena.make<InventoryList>();
+        inventoryList->setTilesetImage(TerminalTileSet);
+        // Inside the box, on the terminal's transparent background.
+        inventoryList->setPosition(2 * ptui::ttmTileWidth, 2 * ptui::ttmTileHeight);
+        // Red for the selection, dimmed for items which can't be used.
+        inventoryList->setColors(1, 0, 88 + 6, 88 + 5, 3);
+        inventoryList->setColors(2, 0, 5, 3, 3);
+        inventoryList->setSource(describeItem, this, itemCount);
+        return true;
+    }
+}
+
+void InventoryTest::enter() noexcept
+{
+    uiOverlay = InventoryOverlay;
+    fillers[2] = governUIFillers(overlayLineFillers);
+    input::buttons.setRepeat(input::Up | input::Down, 12, 2);
+}
+
+bool InventoryTest::update() noexcept
+{
+    using PC=Pokitto::Core;
+    const auto& buttons = input::buttons;
+    
+    for (input::Event event; input::buttons.poll(event);)
+        if ((event.type != input::EventType::Released) && ((event.button == input::Up) || (event.button == input::Down)))
         {
-            ptui::tasUITileMap.setCursorDelta((rand() % 8) * 8);
-            for (auto syllables = 1 + rand() % 8; syllables > 0; syllables--)
-                ptui::tasUITileMap.printText(words[rand() % 46]);
-            ptui::tasUITileMap.printString(poncts[rand() % 5]);
+            _autoScroll = 0;
+            _select((_selected + ((event.button == input::Down) ? 1 : itemCount - 1)) % itemCount);
         }
-        if (ticks == 60)
+    
+    int scroll = inventoryList->scroll();
+    
+    if (_autoScroll != 0)
+    {
+        scroll += _autoScroll;
+        if ((scroll <= 0) || (scroll >= int(inventoryList->maxScroll())))
+            _autoScroll = -_autoScroll;
+    }
+    else
+    {
+        // Eases towards the selection.
+        int distance = int(inventoryList->scrollRevealing(_selected)) - scroll;
+        
+        scroll += (distance / 4 != 0) ? distance / 4 : distance;
+    }
+    inventoryList->scrollTo(std::max(scroll, 0));
+    
+    _ticks++;
+    if (_ticks == 60)
+    {
+        scene::frameScheduler.post(printFPSJob, nullptr);
+        _ticks = 0;
+        ptui::tasUITileMap.setCursor(30, 1);
+        ptui::tasUITileMap.printInteger(PC::fps_counter, 3);
+    }
+    
+    return !buttons.held(input::C);
+}
+
+void InventoryTest::exit() noexcept
+{
+    lastDroppedUIFeatures = droppedUIFeatures();
+    input::buttons.setRepeat(input::Up | input::Down, 0, 0);
+    inventoryList = nullptr;
+}
+
+std::uint8_t InventoryTest::describeItem(void* self, unsigned index, char* tiles, unsigned columns) noexcept
+{
+    unsigned quantity = 1 + index * 37 % 99;
+    
+    snprintf(tiles, columns - 4, "%03u %s%s%s", index, words[index % 46], words[index * 7 % 46], words[index * 13 % 46]);
+    tiles[columns - 3] = 'x';
+    tiles[columns - 2] = '0' + quantity / 10;
+    tiles[columns - 1] = '0' + quantity % 10;
+    return static_cast<InventoryTest*>(self)->_styleOf(index);
+}
+
+std::uint8_t InventoryTest::_styleOf(unsigned index) const noexcept
+{
+    if (index == _selected)
+        return 1;
+    return (index % 9 == 4) ? 2 : 0;
+}
+
+void InventoryTest::_select(unsigned index) noexcept
+{
+    unsigned previous = _selected;
+    
+    _selected = index;
+    inventoryList->setStyle(previous, _styleOf(previous));
+    inventoryList->setStyle(index, _styleOf(index));
+}
+
+#ifdef DESKTOP
+// Times the cell layouts of ptui::CellTileMap on the terminal's grid, filled like the perfs tests' UI.
+class CellLayoutBenchmark : public scene::Scene
+{
+public:
+    bool preload(unsigned step) noexcept override;
+    void enter() noexcept override;
+    bool update() noexcept override;
+
+private:
+    struct Result
+    {
+        const char* layout;
+        unsigned bytes;
+        // Per fully rendered screen, and per 30x3 delta fill, in microseconds.
+        std::uint32_t renderTime;
+        std::uint32_t fillTime;
+    };
+    
+    static constexpr unsigned renderPasses = 100;
+    static constexpr unsigned fillPasses = 10000;
+    
+    template<class LayoutT>
+    static Result _measure(const char* layout) noexcept;
+    
+    Result _results[3];
+};
+
+template<class LayoutT>
+CellLayoutBenchmark::Result CellLayoutBenchmark::_measure(const char* layout) noexcept
+{
+    using scene::FrameScheduler;
+    
+    static ptui::CellTileMap<LayoutT, ptui::ttmColumns, ptui::ttmRows, ptui::ttmTileWidth, ptui::ttmTileHeight, ptui::lcdWidth> tileMap;
+    static std::uint8_t line[PROJ_LCDWIDTH];
+    
+    tileMap.setTilesetImage(TerminalTileSet);
+    tileMap.clear(32, 8);
+    tileMap.fillRectTilesAndDeltas(1, 1, 35, 28, 'a', 0);
+    tileMap.fillRectDeltas(2, 4, 26, 6, 16);
+    
+    auto start = FrameScheduler::now();
+    
+    for (unsigned pass = 0; pass < renderPasses; pass++)
+        for (unsigned y = 0; y < PROJ_LCDHEIGHT; y++)
+            tileMap.template renderIntoLineBuffer<true>(line, y, false);
+    
+    auto renderTime = (FrameScheduler::now() - start) / renderPasses;
+    
+    start = FrameScheduler::now();
+    for (unsigned pass = 0; pass < fillPasses; pass++)
+        tileMap.fillRectDeltas(2, 20, 31, 22, pass);
+    
+    auto fillTime = (FrameScheduler::now() - start) * 1000 / fillPasses;
+    
+    return {layout, unsigned(sizeof(tileMap)), renderTime, fillTime};
+}
+
+bool CellLayoutBenchmark::preload(unsigned step) noexcept
+{
+    switch (step)
+    {
+    case 0:
+        ptui::tasUITileMap.setTilesetImage(TerminalTileSet);
+        ptui::tasUITileMap.clear(32, 0);
+        ptui::tasUITileMap.setOffset(0, 0);
+        ptui::tasUITileMap.setCursorDelta(0);
+        return false;
+    
+    // A layout per step, as each takes a while.
+    case 1:
+        _results[0] = _measure<ptui::InterleavedCells>("interleaved");
+        return false;
+    
+    case 2:
+        _results[1] = _measure<ptui::SplitPlanes>("split");
+        return false;
+    
+    default:
+        _results[2] = _measure<ptui::TilesOnly>("tiles only");
+        ptui::stampFrame(ptui::tasUITileMap, ptui::boxFrame, 1, 1, 35, 8);
+        for (unsigned i = 0; i < 3; i++)
         {
-            printf("fps=%d\n", PC::fps_counter);
-            ticks = 0;
+            auto& result = _results[i];
+            
+            printf("%-12s %5u bytes, render %5u us/screen, fillRectDeltas %5u ns\n", result.layout, result.bytes,
+                   unsigned(result.renderTime), unsigned(result.fillTime));
+            ptui::tasUITileMap.setCursor(2, 2 + i * 2);
+            ptui::tasUITileMap.printString(result.layout);
+            ptui::tasUITileMap.setCursor(14, 2 + i * 2);
+            ptui::tasUITileMap.printInteger(result.renderTime);
+            ptui::tasUITileMap.printString("us ");
+            ptui::tasUITileMap.printInteger(result.fillTime);
+            ptui::tasUITileMap.printString("ns");
         }
+        return true;
     }
-    
-    return 0;
 }
 
+void CellLayoutBenchmark::enter() noexcept
+{
+    fillers[2] = selectUIFillers();
+}
+
+bool CellLayoutBenchmark::update() noexcept
+{
+    return !input::buttons.held(input::C);
+}
+#endif
+
 void resetUIColors() noexcept
 {
     // Configuring UI's Colors.
@@ -516,100 +954,151 @@ void resetUIColors() noexcept
     // Remaps the light UI colors to green for subpalette 24.
     ptui::tasUITileMap.mapColor(24+5, 112+5);
     ptui::tasUITileMap.mapColor(24+6, 112+6);
+    // Dims the light UI colors for subpalette 32, for disabled items.
+    ptui::tasUITileMap.mapColor(32+5, 3);
+    ptui::tasUITileMap.mapColor(32+6, 5);
     // Transparent background for subpalette 40.
     ptui::tasUITileMap.mapColor(40+1, 0);
 }
 
-int intermission(const char* nextScene)
+class Intermission : public scene::Scene
+{
+public:
+    explicit Intermission(const char* nextScene) noexcept : _nextScene(nextScene) {}
+    
+    bool preload(unsigned step) noexcept override;
+    bool update() noexcept override;
+
+private:
+    const char* _nextScene;
+    int _ticks;
+};
+
+bool Intermission::preload(unsigned step) noexcept
+{
+    switch (step)
+    {
+    case 0:
+        _ticks = 0;
+        ptui::tasUITileMap.setTilesetImage(TerminalTileSet);
+        ptui::tasUITileMap.clear(32, 8);
+        ptui::tasUITileMap.setOffset(0, 0);
+        ptui::tasUITileMap.setCursorDelta(0);
+        return false;
+    
+    default:
+        resetUIColors();
+        fillers[2] = selectUIFillers();
+        return true;
+    }
+}
+
+bool Intermission::update() noexcept
 {
     using PC=Pokitto::Core;
-    using PD=Pokitto::Display;
-    using PB=Pokitto::Buttons;
+    const auto& buttons = input::buttons;
     
-    int ticks = 0;
     
-    // Configuration.
-    ptui::tasUITileMap.setTilesetImage(TerminalTileSet);
-    ptui::tasUITileMap.clear(32, 8);
-    ptui::tasUITileMap.setOffset(0, 0);
-    resetUIColors();
+    if (buttons.held(input::Left)) renderTransparency = false;
+    if (buttons.held(input::Right)) renderTransparency = true;
+    if (buttons.held(input::Up)) renderCLUT = true;
+    if (buttons.held(input::Down)) renderCLUT = false;
+    if (buttons.held(input::A)) renderColorOffset = true;
+    if (buttons.held(input::B)) renderColorOffset = false;
     
-    PD::lineFillers[0] = TAS::NOPFiller;
-    PD::lineFillers[1] = TAS::NOPFiller;
+    ptui::stampFrame(ptui::tasUITileMap, ptui::boxFrame, 1, 1, 30, 3);
+    ptui::tasUITileMap.setCursor(2, 2);
+    ptui::tasUITileMap.printString("Next:");
+    ptui::tasUITileMap.printString(_nextScene);
     
-    // Drawing the UI.
-    ptui::tasUITileMap.setCursorDelta(0);
-    while (PC::isRunning() && PB::cBtn())
+    
+    ptui::stampFrame(ptui::tasUITileMap, ptui::boxFrame, 1, 5, 36, 7);
+    ptui::tasUITileMap.setCursor(2, 6);
+    ptui::tasUITileMap.printString("Trans=");
+    ptui::tasUITileMap.printString(renderTransparency ? "ON" : "OFF");
+    ptui::tasUITileMap.printString(", CLUT=");
+    ptui::tasUITileMap.printString(renderCLUT ? "ON" : "OFF");
+    ptui::tasUITileMap.printString(", COff=");
+    ptui::tasUITileMap.printString(renderColorOffset ? "ON" : "OFF");
+    
+    // What these options were worth in the last gameplay scene, once the quality governor fell back.
+    if (lastDroppedUIFeatures)
     {
-        if (!PC::update()) 
-            continue;
-        
-        if (PB::leftBtn()) renderTransparency = false;
-        if (PB::rightBtn()) renderTransparency = true;
-        if (PB::upBtn()) renderCLUT = true;
-        if (PB::downBtn()) renderCLUT = false;
-        if (PB::aBtn()) renderColorOffset = true;
-        if (PB::bBtn()) renderColorOffset = false;
-        
-        ptui::tasUITileMap.drawBox(1, 1, 30, 3);
-        ptui::tasUITileMap.setCursor(2, 2);
-        ptui::tasUITileMap.printString("Next:");
-        ptui::tasUITileMap.printString(nextScene);
-        
-        
-        ptui::tasUITileMap.drawBox(1, 5, 36, 7);
-        ptui::tasUITileMap.setCursor(2, 6);
-        ptui::tasUITileMap.printString("Trans=");
-        ptui::tasUITileMap.printString(renderTransparency ? "ON" : "OFF");
-        ptui::tasUITileMap.printString(", CLUT=");
-        ptui::tasUITileMap.printString(renderCLUT ? "ON" : "OFF");
-        ptui::tasUITileMap.printString(", COff=");
-        ptui::tasUITileMap.printString(renderColorOffset ? "ON" : "OFF");
-
-        ticks++;
-        if (ticks == 60)
-        {
-            printf("fps=%d\n", PC::fps_counter);
-            ticks = 0;
-            ptui::tasUITileMap.drawBox(30, 1, 35, 3);
-            ptui::tasUITileMap.setCursor(32, 2);
-            ptui::tasUITileMap.printInteger(PC::fps_counter);
-        }
-        
-        int lineFillerIndex = (renderTransparency ? 4 : 0) + (renderCLUT ? 2 : 0) | (renderColorOffset ? 1 : 0);
-        
-        PD::lineFillers[2] = availableLineFillers[lineFillerIndex];
+        ptui::stampFrame(ptui::tasUITileMap, ptui::boxFrame, 1, 8, 36, 10);
+        ptui::tasUITileMap.setCursor(2, 9);
+        ptui::tasUITileMap.printString("Last scene dropped:");
+        ptui::tasUITileMap.printString((lastDroppedUIFeatures & 4) ? " Trans" : "");
+        ptui::tasUITileMap.printString((lastDroppedUIFeatures & 2) ? " CLUT" : "");
+        ptui::tasUITileMap.printString((lastDroppedUIFeatures & 1) ? " COff" : "");
     }
     
-    return 0;
+    _ticks++;
+    if (_ticks == 60)
+    {
+        scene::frameScheduler.post(printFPSJob, nullptr);
+        _ticks = 0;
+        ptui::stampFrame(ptui::tasUITileMap, ptui::boxFrame, 30, 1, 35, 3);
+        ptui::tasUITileMap.setCursor(32, 2);
+        ptui::tasUITileMap.printInteger(PC::fps_counter);
+    }
+    fillers[2] = selectUIFillers();
+    
+    return buttons.held(input::C);
 }
 
+Intermission perfsFullIntermission("Test - Perfs Full");
+PerfsFullTest perfsFullTest(false);
+Intermission perfsCroppedIntermission("Test - Perfs Cropped");
+PerfsFullTest perfsCroppedTest(true);
+Intermission perfsStairsIntermission("Test - Perfs Stairs");
+PerfsStairsTest perfsStairsTest;
+Intermission battleMockupIntermission("Battle Mockup");
+BattleMockup battleMockup;
+Intermission randomWordsIntermission("Random Words");
+RandomWordsTest randomWordsTest;
+Intermission inventoryIntermission("Test - Inventory");
+InventoryTest inventoryTest;
+#ifdef DESKTOP
+Intermission cellLayoutIntermission("Bench - Cell Layouts");
+CellLayoutBenchmark cellLayoutBenchmark;
+#endif
+
+// Build with -DINPUT_RECORD to record a run's buttons and RNG seed, then with -DINPUT_REPLAY to play the same run again,
+// e.g. to compare the performances of two builds.
+#ifdef POKITTO
+const char* const inputRecording = "/sd/perfs.rec";
+#else
+const char* const inputRecording = "perfs.rec";
+#endif
+
+scene::Scene* const scenes[] =
+{
+    &perfsFullIntermission, &perfsFullTest,
+    &perfsCroppedIntermission, &perfsCroppedTest,
+    &perfsStairsIntermission, &perfsStairsTest,
+    &battleMockupIntermission, &battleMockup,
+    &randomWordsIntermission, &randomWordsTest,
+    &inventoryIntermission, &inventoryTest,
+#ifdef DESKTOP
+    &cellLayoutIntermission, &cellLayoutBenchmark,
+#endif
+};
+
 int main() noexcept
 {
     using PC=Pokitto::Core;
     using PD=Pokitto::Display;
-    using PB=Pokitto::Buttons;
     
     PC::begin();
     PD::loadRGBPalette(miloslav);
-    PD::lineFillers[2] = availableLineFillers[7];
-    
-    while (PC::isRunning())
-    {
-        intermission("Test - Perfs Full");
-        testPerfsFull(false);
-        
-        intermission("Test - Perfs Cropped");
-        testPerfsFull(true);
-        
-        intermission("Test - Perfs Stairs");
-        testPerfsStairs();
-        
-        intermission("Battle Mockup");
-        battleMockup();
-        
-        intermission("Random Words");
-        testRandomWords();
-    }
+#if defined(INPUT_REPLAY)
+    if (!input::recorder.replay(inputRecording))
+        printf("Can't replay %s\n", inputRecording);
+#elif defined(INPUT_RECORD)
+    if (!input::recorder.record(inputRecording, scene::FrameScheduler::now()))
+        printf("Can't record %s\n", inputRecording);
+#endif
+    scene::play(scenes, sizeof(scenes) / sizeof(scenes[0]));
+    input::recorder.stop();
     return 0;
 }
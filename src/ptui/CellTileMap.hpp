@@ -0,0 +1,269 @@
+#ifndef PTUI_CELLTILEMAP_HPP
+#   define PTUI_CELLTILEMAP_HPP
+
+#   include <algorithm>
+#   include <cstdint>
+
+
+namespace ptui
+{
+    // Cell layouts for CellTileMap. Each one stores a tile index and a colour delta per cell, and trades RAM and speed differently.
+    
+    // A 16-bit word per cell, tile on the low byte and delta on the high one: rendering loads each cell once.
+    struct InterleavedCells
+    {
+        template<unsigned countP>
+        class Storage
+        {
+        public:
+            static constexpr bool hasDeltas = true;
+            
+            std::uint8_t tile(unsigned index) const noexcept { return _cells[index]; }
+            std::uint8_t delta(unsigned index) const noexcept { return _cells[index] >> 8; }
+            
+            // Both at once, with a single load.
+            void load(unsigned index, std::uint8_t& tile, std::uint8_t& delta) const noexcept
+            {
+                std::uint16_t cell = _cells[index];
+                
+                tile = cell;
+                delta = cell >> 8;
+            }
+            
+            void set(unsigned index, std::uint8_t tile, std::uint8_t delta) noexcept { _cells[index] = tile | (delta << 8); }
+            void setTile(unsigned index, std::uint8_t tile) noexcept { _cells[index] = (_cells[index] & 0xFF00) | tile; }
+            void setDelta(unsigned index, std::uint8_t delta) noexcept { _cells[index] = (_cells[index] & 0x00FF) | (delta << 8); }
+            
+            void fill(unsigned first, unsigned count, std::uint8_t tile, std::uint8_t delta) noexcept
+            {
+                std::fill(_cells + first, _cells + first + count, std::uint16_t(tile | (delta << 8)));
+            }
+            
+            void fillTiles(unsigned first, unsigned count, std::uint8_t tile) noexcept
+            {
+                for (unsigned i = first; i < first + count; i++)
+                    setTile(i, tile);
+            }
+            
+            void fillDeltas(unsigned first, unsigned count, std::uint8_t delta) noexcept
+            {
+                for (unsigned i = first; i < first + count; i++)
+                    setDelta(i, delta);
+            }
+        
+        private:
+            std::uint16_t _cells[countP] = {};
+        };
+    };
+    
+    // A plane of tiles and a plane of deltas: filling either is a plain memset, rendering loads each cell twice.
+    struct SplitPlanes
+    {
+        template<unsigned countP>
+        class Storage
+        {
+        public:
+            static constexpr bool hasDeltas = true;
+            
+            std::uint8_t tile(unsigned index) const noexcept { return _tiles[index]; }
+            std::uint8_t delta(unsigned index) const noexcept { return _deltas[index]; }
+            
+            void load(unsigned index, std::uint8_t& tile, std::uint8_t& delta) const noexcept
+            {
+                tile = _tiles[index];
+                delta = _deltas[index];
+            }
+            
+            void set(unsigned index, std::uint8_t tile, std::uint8_t delta) noexcept
+            {
+                _tiles[index] = tile;
+                _deltas[index] = delta;
+            }
+            
+            void setTile(unsigned index, std::uint8_t tile) noexcept { _tiles[index] = tile; }
+            void setDelta(unsigned index, std::uint8_t delta) noexcept { _deltas[index] = delta; }
+            
+            void fill(unsigned first, unsigned count, std::uint8_t tile, std::uint8_t delta) noexcept
+            {
+                fillTiles(first, count, tile);
+                fillDeltas(first, count, delta);
+            }
+            
+            void fillTiles(unsigned first, unsigned count, std::uint8_t tile) noexcept { std::fill(_tiles + first, _tiles + first + count, tile); }
+            void fillDeltas(unsigned first, unsigned count, std::uint8_t delta) noexcept { std::fill(_deltas + first, _deltas + first + count, delta); }
+        
+        private:
+            std::uint8_t _tiles[countP] = {};
+            std::uint8_t _deltas[countP] = {};
+        };
+    };
+    
+    // Tiles only, for monochrome HUDs: half the RAM, and deltas are ignored.
+    struct TilesOnly
+    {
+        template<unsigned countP>
+        class Storage
+        {
+        public:
+            static constexpr bool hasDeltas = false;
+            
+            std::uint8_t tile(unsigned index) const noexcept { return _tiles[index]; }
+            std::uint8_t delta(unsigned) const noexcept { return 0; }
+            
+            void load(unsigned index, std::uint8_t& tile, std::uint8_t& delta) const noexcept
+            {
+                tile = _tiles[index];
+                delta = 0;
+            }
+            
+            void set(unsigned index, std::uint8_t tile, std::uint8_t) noexcept { _tiles[index] = tile; }
+            void setTile(unsigned index, std::uint8_t tile) noexcept { _tiles[index] = tile; }
+            void setDelta(unsigned, std::uint8_t) noexcept {}
+            
+            void fill(unsigned first, unsigned count, std::uint8_t tile, std::uint8_t) noexcept { fillTiles(first, count, tile); }
+            void fillTiles(unsigned first, unsigned count, std::uint8_t tile) noexcept { std::fill(_tiles + first, _tiles + first + count, tile); }
+            void fillDeltas(unsigned, unsigned, std::uint8_t) noexcept {}
+        
+        private:
+            std::uint8_t _tiles[countP] = {};
+        };
+    };
+    
+    namespace details
+    {
+        template<bool transparentP>
+        inline void copyPixel(std::uint8_t* destination, std::uint8_t pixel, std::uint8_t delta) noexcept
+        {
+            if (!transparentP || (pixel != 0))
+                *destination = pixel + delta;
+        }
+        
+        // Copies a tile's row with its delta. Unrolled for the terminal's 6 pixel wide glyphs.
+        template<unsigned widthP>
+        struct TileRow
+        {
+            template<bool transparentP>
+            static void copy(std::uint8_t* destination, const std::uint8_t* pixels, std::uint8_t delta) noexcept
+            {
+                for (unsigned i = 0; i < widthP; i++)
+                    copyPixel<transparentP>(destination + i, pixels[i], delta);
+            }
+        };
+        
+        template<>
+        struct TileRow<6>
+        {
+            template<bool transparentP>
+            static void copy(std::uint8_t* destination, const std::uint8_t* pixels, std::uint8_t delta) noexcept
+            {
+                copyPixel<transparentP>(destination + 0, pixels[0], delta);
+                copyPixel<transparentP>(destination + 1, pixels[1], delta);
+                copyPixel<transparentP>(destination + 2, pixels[2], delta);
+                copyPixel<transparentP>(destination + 3, pixels[3], delta);
+                copyPixel<transparentP>(destination + 4, pixels[4], delta);
+                copyPixel<transparentP>(destination + 5, pixels[5], delta);
+            }
+        };
+    }
+    
+    // A grid of 8bpp tiles with a colour delta per cell, added to the tile's non-transparent pixels.
+    // The cells' layout in RAM is a policy: InterleavedCells, SplitPlanes or TilesOnly.
+    // The tileset is raw, tileWidthP x tileHeightP bytes per tile, as TerminalTileSet.
+    template<class LayoutT, unsigned columnsP, unsigned rowsP, unsigned tileWidthP, unsigned tileHeightP, unsigned lineWidthP>
+    class CellTileMap
+    {
+    public:
+        static constexpr unsigned columns = columnsP;
+        static constexpr unsigned rows = rowsP;
+        static constexpr unsigned tileWidth = tileWidthP;
+        static constexpr unsigned tileHeight = tileHeightP;
+        static constexpr bool hasDeltas = LayoutT::template Storage<columnsP * rowsP>::hasDeltas;
+        
+        void setTilesetImage(const std::uint8_t* tileset) noexcept { _tileset = tileset; }
+        
+        // Where the map's top-left corner is on screen, in pixels.
+        void setOffset(int x, int y) noexcept
+        {
+            _offsetX = x;
+            _offsetY = y;
+        }
+        
+        std::uint8_t tile(unsigned x, unsigned y) const noexcept { return _cells.tile(y * columnsP + x); }
+        std::uint8_t delta(unsigned x, unsigned y) const noexcept { return _cells.delta(y * columnsP + x); }
+        
+        void setTile(unsigned x, unsigned y, std::uint8_t tile) noexcept { _cells.setTile(y * columnsP + x, tile); }
+        void setDelta(unsigned x, unsigned y, std::uint8_t delta) noexcept { _cells.setDelta(y * columnsP + x, delta); }
+        void setTileAndDelta(unsigned x, unsigned y, std::uint8_t tile, std::uint8_t delta) noexcept { _cells.set(y * columnsP + x, tile, delta); }
+        
+        void clear(std::uint8_t tile = 0, std::uint8_t delta = 0) noexcept { _cells.fill(0, columnsP * rowsP, tile, delta); }
+        
+        // Fills the cells within [x1; x2] x [y1; y2], clipped to the map as UITileMap does.
+        void fillRectTiles(int x1, int y1, int x2, int y2, std::uint8_t tile) noexcept
+        {
+            if (!_clip(x1, y1, x2, y2))
+                return;
+            for (int y = y1; y <= y2; y++)
+                _cells.fillTiles(y * columnsP + x1, x2 - x1 + 1, tile);
+        }
+        
+        void fillRectDeltas(int x1, int y1, int x2, int y2, std::uint8_t delta) noexcept
+        {
+            if (!_clip(x1, y1, x2, y2))
+                return;
+            for (int y = y1; y <= y2; y++)
+                _cells.fillDeltas(y * columnsP + x1, x2 - x1 + 1, delta);
+        }
+        
+        void fillRectTilesAndDeltas(int x1, int y1, int x2, int y2, std::uint8_t tile, std::uint8_t delta) noexcept
+        {
+            if (!_clip(x1, y1, x2, y2))
+                return;
+            for (int y = y1; y <= y2; y++)
+                _cells.fill(y * columnsP + x1, x2 - x1 + 1, tile, delta);
+        }
+        
+        // Renders the map's pixels crossing the line. Transparent maps leave the line's pixels behind 0 pixels untouched.
+        template<bool transparentP>
+        void renderIntoLineBuffer(std::uint8_t* line, std::uint32_t y, bool skip) const noexcept
+        {
+            int mapY = int(y) - _offsetY;
+            
+            if (skip || (mapY < 0) || (mapY >= int(rowsP * tileHeightP)))
+                return;
+            
+            // Only whole tiles within the line are rendered, which fits UI grids aligned on the screen.
+            int firstColumn = (_offsetX < 0) ? (-_offsetX + int(tileWidthP) - 1) / int(tileWidthP) : 0;
+            int lastColumn = std::min(int(columnsP), (int(lineWidthP) - _offsetX) / int(tileWidthP));
+            unsigned index = (mapY / tileHeightP) * columnsP + firstColumn;
+            const std::uint8_t* tileRow = _tileset + (mapY % tileHeightP) * tileWidthP;
+            std::uint8_t* destination = line + _offsetX + firstColumn * int(tileWidthP);
+            
+            for (int column = firstColumn; column < lastColumn; column++, index++, destination += tileWidthP)
+            {
+                std::uint8_t tile, delta;
+                
+                _cells.load(index, tile, delta);
+                details::TileRow<tileWidthP>::template copy<transparentP>(destination, tileRow + tile * (tileWidthP * tileHeightP), delta);
+            }
+        }
+    
+    private:
+        // Clamps the rectangle to the map, and returns whether anything is left of it.
+        static bool _clip(int& x1, int& y1, int& x2, int& y2) noexcept
+        {
+            x1 = std::max(x1, 0);
+            y1 = std::max(y1, 0);
+            x2 = std::min(x2, int(columnsP) - 1);
+            y2 = std::min(y2, int(rowsP) - 1);
+            return (x1 <= x2) && (y1 <= y2);
+        }
+        
+        typename LayoutT::template Storage<columnsP * rowsP> _cells;
+        const std::uint8_t* _tileset = nullptr;
+        int _offsetX = 0;
+        int _offsetY = 0;
+    };
+}
+
+
+#endif // PTUI_CELLTILEMAP_HPP
@@ -0,0 +1,90 @@
+#ifndef PTUI_FRAMES_HPP
+#   define PTUI_FRAMES_HPP
+
+#   include <cstdint>
+
+
+namespace ptui
+{
+    enum FrameSlice : std::uint8_t
+    {
+        TopLeft, Top, TopRight,
+        Left, Inside, Right,
+        BottomLeft, Bottom, BottomRight
+    };
+    
+    // A 9-slice frame: corners, edges and inside, stretched to any size.
+    struct FrameStyle
+    {
+        // The tiles of each FrameSlice.
+        std::uint8_t tiles[9];
+        std::uint8_t delta;
+        std::uint8_t insideDelta;
+        // Whether the inside is stamped too, or left as it is.
+        bool filled;
+        // Whether the frame casts a shadow on its right and below it, tinting what's there with shadowDelta.
+        bool shadowed;
+        std::uint8_t shadowDelta;
+    };
+    
+    // The terminal tileset's box, as drawBox() draws it.
+    constexpr FrameStyle boxFrame{{24, 25, 26, 31, 0, 27, 30, 29, 28}, 0, 0, false, false, 0};
+    // The same box, cleared inside.
+    constexpr FrameStyle panelFrame{{24, 25, 26, 31, 0, 27, 30, 29, 28}, 0, 0, true, false, 0};
+    
+    // A style casting a shadow, e.g. shadowed(boxFrame, 32).
+    constexpr FrameStyle shadowed(FrameStyle style, std::uint8_t shadowDelta) noexcept
+    {
+        style.shadowed = true;
+        style.shadowDelta = shadowDelta;
+        return style;
+    }
+    
+    namespace details
+    {
+        // A band of the frame's rows, as a block write per slice: its left slice, its middle one and its right one.
+        template<class TileMapT>
+        void stampFrameBand(TileMapT& tileMap, const std::uint8_t* slices, std::uint8_t delta, bool middle, std::uint8_t middleDelta,
+                            int x1, int y1, int x2, int y2) noexcept
+        {
+            tileMap.fillRectTilesAndDeltas(x1, y1, x1, y2, slices[0], delta);
+            if (middle && (x2 - x1 >= 2))
+                tileMap.fillRectTilesAndDeltas(x1 + 1, y1, x2 - 1, y2, slices[1], middleDelta);
+            tileMap.fillRectTilesAndDeltas(x2, y1, x2, y2, slices[2], delta);
+        }
+    }
+    
+    // Stamps a frame whose corners are at x1, y1 and x2, y2, on a UI tile map or a CellTileMap.
+    // It takes at most 9 block writes whatever its size, stamping a band of rows at a time.
+    // The shadow lies a column and a row past the frame, which both maps clip when the frame touches their edges.
+    template<class TileMapT>
+    void stampFrame(TileMapT& tileMap, const FrameStyle& style, int x1, int y1, int x2, int y2) noexcept
+    {
+        if ((x2 <= x1) || (y2 <= y1))
+            return;
+        details::stampFrameBand(tileMap, style.tiles + TopLeft, style.delta, true, style.delta, x1, y1, x2, y1);
+        if (y2 - y1 >= 2)
+            details::stampFrameBand(tileMap, style.tiles + Left, style.delta, style.filled, style.insideDelta, x1, y1 + 1, x2, y2 - 1);
+        details::stampFrameBand(tileMap, style.tiles + BottomLeft, style.delta, true, style.delta, x1, y2, x2, y2);
+        if (style.shadowed)
+        {
+            tileMap.fillRectDeltas(x2 + 1, y1 + 1, x2 + 1, y2 + 1, style.shadowDelta);
+            tileMap.fillRectDeltas(x1 + 1, y2 + 1, x2, y2 + 1, style.shadowDelta);
+        }
+    }
+    
+    // Erases a stamped frame with the given tile and delta, and lifts its shadow's tint.
+    template<class TileMapT>
+    void eraseFrame(TileMapT& tileMap, const FrameStyle& style, int x1, int y1, int x2, int y2, std::uint8_t tile = 0, std::uint8_t delta = 0) noexcept
+    {
+        tileMap.fillRectTilesAndDeltas(x1, y1, x2, y2, tile, delta);
+        if (style.shadowed)
+        {
+            tileMap.fillRectDeltas(x2 + 1, y1 + 1, x2 + 1, y2 + 1, 0);
+            tileMap.fillRectDeltas(x1 + 1, y2 + 1, x2, y2 + 1, 0);
+        }
+    }
+}
+
+
+#endif // PTUI_FRAMES_HPP
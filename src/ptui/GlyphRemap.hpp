@@ -0,0 +1,42 @@
+#ifndef PTUI_GLYPHREMAP_HPP
+#   define PTUI_GLYPHREMAP_HPP
+
+#   include <cstdint>
+
+
+namespace ptui
+{
+    // Where a tileset's characters are, as generated by scripts/FontConverter.cpp.
+    // ASCII characters are usually their own tiles, as printString() expects. The others are found through a perfect hash
+    // of their code points: the slot (codePoint * multiplier) >> (32 - bits) holds either that code point or none in the tileset.
+    struct GlyphRemap
+    {
+        std::uint32_t multiplier;
+        std::uint8_t bits;
+        // False for packed tilesets, whose ASCII characters are hashed too.
+        bool asciiIsIdentity;
+        // The tile of characters missing from the tileset.
+        std::uint8_t missingTile;
+        // 1 << bits slots each.
+        const std::uint32_t* codePoints;
+        const std::uint8_t* tiles;
+        
+        constexpr std::uint8_t tileOf(std::uint32_t codePoint) const noexcept
+        {
+            if (asciiIsIdentity && (codePoint < 0x80))
+                return codePoint;
+            if (bits == 0)
+                return missingTile;
+            
+            std::uint32_t slot = std::uint32_t(codePoint * multiplier) >> (32 - bits);
+            
+            return (codePoints[slot] == codePoint) ? tiles[slot] : missingTile;
+        }
+    };
+    
+    // For tilesets with ASCII characters only.
+    constexpr GlyphRemap asciiGlyphs{0, 0, true, '?', nullptr, nullptr};
+}
+
+
+#endif // PTUI_GLYPHREMAP_HPP
@@ -0,0 +1,192 @@
+#ifndef PTUI_LISTVIEW_HPP
+#   define PTUI_LISTVIEW_HPP
+
+#   include <algorithm>
+#   include <cstdint>
+
+#   include "ptui/TASTerminalTileMap.hpp"
+
+
+namespace ptui
+{
+    // Fills an item's row, whose tiles are columns spaces, and returns its style, see ListView::setColors().
+    // Zeros left in the row, e.g. by snprintf(), show as spaces.
+    using ListSource = std::uint8_t (*)(void* context, unsigned index, char* tiles, unsigned columns);
+    
+    // A window over a list too long for the tile map, e.g. an inventory or a log, composited over the terminal.
+    // Only the visible rows are kept, in a ring: item i is always in row i % ringRows, so scrolling renders the rows
+    // scrolled into view through the source, and nothing else. Scrolling is smooth, a pixel at a time.
+    // Styles are per row, so highlighting an item is a byte to change.
+    template<unsigned columnsP, unsigned rowsP>
+    class ListView
+    {
+    public:
+        static constexpr unsigned columns = columnsP;
+        static constexpr unsigned rows = rowsP;
+        static constexpr unsigned tileWidth = ttmTileWidth;
+        static constexpr unsigned tileHeight = ttmTileHeight;
+        static constexpr unsigned height = rowsP * tileHeight;
+        static constexpr unsigned styleCount = 4;
+        
+        static_assert(columnsP * tileWidth <= lcdWidth, "The list must fit in the screen's width");
+        
+        ListView() noexcept
+        {
+            for (unsigned style = 0; style < styleCount; style++)
+                setColors(style, 0, 6, 5, 3);
+        }
+        
+        // A terminal tileset, whose background is colour 1 and whose inks are colours 6, 5 and 3.
+        void setTilesetImage(const std::uint8_t* tileset) noexcept { _tileset = tileset; }
+        
+        // The list's top-left corner on screen, in pixels. It must stay within the screen's width.
+        void setPosition(int x, int y) noexcept
+        {
+            _x = x;
+            _y = y;
+        }
+        
+        // The screen colours of a style's background and inks, 0 being transparent.
+        void setColors(unsigned style, std::uint8_t background, std::uint8_t ink, std::uint8_t secondInk, std::uint8_t thirdInk) noexcept
+        {
+            std::uint8_t* colors = _colors[style];
+            
+            std::fill(colors, colors + 8, 0);
+            colors[1] = background;
+            colors[6] = ink;
+            colors[5] = secondInk;
+            colors[3] = thirdInk;
+        }
+        
+        // Binds the list to its items, scrolled to the top.
+        void setSource(ListSource source, void* context, unsigned count) noexcept
+        {
+            _source = source;
+            _context = context;
+            _count = count;
+            _scroll = 0;
+            for (unsigned index = 0; index < ringRows; index++)
+                _renderRow(index);
+        }
+        
+        unsigned count() const noexcept { return _count; }
+        
+        // Items added or removed at the end. Changed items need a refresh().
+        void setCount(unsigned count) noexcept
+        {
+            unsigned first = _scroll / tileHeight;
+            
+            _count = count;
+            for (unsigned index = first; index < first + ringRows; index++)
+                _renderRow(index);
+            scrollTo(_scroll);
+        }
+        
+        // Renders the item again, if it's in the ring.
+        void refresh(unsigned index) noexcept
+        {
+            unsigned first = _scroll / tileHeight;
+            
+            if ((index >= first) && (index < first + ringRows))
+                _renderRow(index);
+        }
+        
+        // Changes an item's style, if it's in the ring, e.g. to highlight it. Rendering it again gives it its source's style.
+        void setStyle(unsigned index, std::uint8_t style) noexcept
+        {
+            unsigned first = _scroll / tileHeight;
+            
+            if ((index >= first) && (index < first + ringRows))
+                _styles[index % ringRows] = style;
+        }
+        
+        // How far down the list is scrolled, in pixels.
+        unsigned scroll() const noexcept { return _scroll; }
+        unsigned maxScroll() const noexcept { return (_count > rowsP) ? (_count - rowsP) * tileHeight : 0; }
+        
+        void scrollTo(unsigned scroll) noexcept
+        {
+            unsigned first = _scroll / tileHeight;
+            
+            _scroll = std::min(scroll, maxScroll());
+            
+            unsigned newFirst = _scroll / tileHeight;
+            
+            for (unsigned index = newFirst; index < newFirst + ringRows; index++)
+                if ((index < first) || (index >= first + ringRows))
+                    _renderRow(index);
+        }
+        
+        // The scroll showing the whole item while moving the least, e.g. to follow a selection.
+        unsigned scrollRevealing(unsigned index) const noexcept
+        {
+            unsigned top = index * tileHeight;
+            
+            if (top < _scroll)
+                return top;
+            if (top + tileHeight > _scroll + height)
+                return top + tileHeight - height;
+            return _scroll;
+        }
+        
+        void renderIntoLineBuffer(std::uint8_t* line, std::uint32_t y, bool skip) const noexcept
+        {
+            int row = int(y) - _y;
+            
+            if (skip || (row < 0) || (row >= int(height)))
+                return;
+            
+            unsigned pixelY = _scroll + row;
+            unsigned slot = (pixelY / tileHeight) % ringRows;
+            const std::uint8_t* colors = _colors[_styles[slot]];
+            const std::uint8_t* tileRow = _tileset + (pixelY % tileHeight) * tileWidth;
+            std::uint8_t* destination = line + _x;
+            
+            for (unsigned column = 0; column < columnsP; column++, destination += tileWidth)
+            {
+                const std::uint8_t* pixels = tileRow + std::uint8_t(_tiles[slot][column]) * (tileWidth * tileHeight);
+                
+                for (unsigned i = 0; i < tileWidth; i++)
+                {
+                    std::uint8_t color = colors[pixels[i] & 7];
+                    
+                    if (color != 0)
+                        destination[i] = color;
+                }
+            }
+        }
+    
+    private:
+        // The visible rows, and the one partly scrolled into view.
+        static constexpr unsigned ringRows = rowsP + 1;
+        
+        void _renderRow(unsigned index) noexcept
+        {
+            char* tiles = _tiles[index % ringRows];
+            
+            std::fill(tiles, tiles + columnsP, ' ');
+            if (index >= _count)
+            {
+                _styles[index % ringRows] = 0;
+                return;
+            }
+            _styles[index % ringRows] = _source(_context, index, tiles, columnsP) % styleCount;
+            std::replace(tiles, tiles + columnsP, '\0', ' ');
+        }
+        
+        char _tiles[ringRows][columnsP] = {};
+        std::uint8_t _styles[ringRows] = {};
+        // Screen colours, indexed by the tileset's.
+        std::uint8_t _colors[styleCount][8];
+        const std::uint8_t* _tileset = nullptr;
+        ListSource _source = nullptr;
+        void* _context = nullptr;
+        unsigned _count = 0;
+        unsigned _scroll = 0;
+        int _x = 0;
+        int _y = 0;
+    };
+}
+
+
+#endif // PTUI_LISTVIEW_HPP
@@ -0,0 +1,155 @@
+#include "ptui/Menu.hpp"
+
+
+namespace ptui
+{
+    void Menu::setDeltas(std::uint8_t delta, std::uint8_t selectedDelta, std::uint8_t disabledDelta) noexcept
+    {
+        _delta = delta;
+        _selectedDelta = selectedDelta;
+        _disabledDelta = disabledDelta;
+    }
+    
+    void Menu::open(TASUITileMap& tileMap, const MenuPage& page, unsigned selected) noexcept
+    {
+        if (selected >= page.count)
+            selected = 0;
+        _tileMap = &tileMap;
+        _levels[0] = {&page, std::uint16_t(selected), std::uint16_t((selected >= page.rows) ? selected - page.rows + 1 : 0)};
+        _depth = 1;
+        _drawPage(_levels[0]);
+    }
+    
+    void Menu::close() noexcept
+    {
+        for (; _depth > 0; _depth--)
+            _erasePage(*_levels[_depth - 1].page);
+    }
+    
+    void Menu::select(unsigned index) noexcept
+    {
+        Level& level = _levels[_depth - 1];
+        const MenuPage& page = *level.page;
+        unsigned previous = level.selected;
+        
+        if (index >= page.count)
+            return;
+        level.selected = index;
+        // Scrolls just enough to show the item.
+        if ((index < level.top) || (index >= level.top + page.rows))
+        {
+            level.top = (index < level.top) ? index : index - page.rows + 1;
+            _drawPage(level);
+            return;
+        }
+        if (index == previous)
+            return;
+        
+        unsigned previousRow = page.y + 1 + previous - level.top;
+        unsigned row = page.y + 1 + index - level.top;
+        
+        _tileMap->setTileAndDelta(page.x + 1, previousRow, ' ', _deltaOf(level, previous));
+        _tileMap->fillRectDeltas(page.x + 2, previousRow, page.x + page.width, previousRow, _deltaOf(level, previous));
+        _tileMap->setTileAndDelta(page.x + 1, row, cursorTile, _selectedDelta);
+        _tileMap->fillRectDeltas(page.x + 2, row, page.x + page.width, row, _selectedDelta);
+    }
+    
+    MenuAction Menu::choose() noexcept
+    {
+        if (page().count == 0)
+            return MenuAction::None;
+        
+        const MenuItem& item = selectedItem();
+        
+        if (item.submenu == nullptr)
+            return item.disabled ? MenuAction::None : MenuAction::Chosen;
+        if (item.disabled || (_depth == maxDepth))
+            return MenuAction::None;
+        _levels[_depth++] = {item.submenu, 0, 0};
+        _drawPage(_levels[_depth - 1]);
+        return MenuAction::Opened;
+    }
+    
+    MenuAction Menu::back() noexcept
+    {
+        if (_depth <= 1)
+        {
+            close();
+            return MenuAction::Closed;
+        }
+        _erasePage(page());
+        _depth--;
+        // The submenu may have covered part of its parent.
+        _drawPage(_levels[_depth - 1]);
+        return MenuAction::Backed;
+    }
+    
+    MenuAction Menu::handle(const input::Event& event) noexcept
+    {
+        if (!isOpen() || (page().count == 0) || (event.type == input::EventType::Released))
+            return MenuAction::None;
+        
+        unsigned count = page().count;
+        
+        switch (event.button)
+        {
+        case input::Up:
+            select((selected() + count - 1) % count);
+            return MenuAction::Moved;
+        
+        case input::Down:
+            select((selected() + 1) % count);
+            return MenuAction::Moved;
+        
+        case input::A:
+            return (event.type == input::EventType::Pressed) ? choose() : MenuAction::None;
+        
+        case input::B:
+            return (event.type == input::EventType::Pressed) ? back() : MenuAction::None;
+        
+        default:
+            return MenuAction::None;
+        }
+    }
+    
+    void Menu::_drawPage(const Level& level) const noexcept
+    {
+        const MenuPage& page = *level.page;
+        unsigned right = page.x + page.width + 1;
+        
+        stampFrame(*_tileMap, *_frame, page.x, page.y, right, page.y + page.rows + 1);
+        for (unsigned row = 0; row < page.rows; row++)
+            _drawRow(level, row);
+        // Marks the hidden items on the box's right border.
+        if (level.top > 0)
+            _tileMap->setTileAndDelta(right, page.y + 1, '^', _delta);
+        if (level.top + page.rows < page.count)
+            _tileMap->setTileAndDelta(right, page.y + page.rows, 'v', _delta);
+    }
+    
+    void Menu::_drawRow(const Level& level, unsigned row) const noexcept
+    {
+        const MenuPage& page = *level.page;
+        unsigned index = level.top + row;
+        unsigned y = page.y + 1 + row;
+        const char* label = (index < page.count) ? page.items[index].label : "";
+        std::uint8_t delta = (index < page.count) ? _deltaOf(level, index) : _delta;
+        
+        _tileMap->setTileAndDelta(page.x + 1, y, (index == level.selected) ? cursorTile : ' ', delta);
+        // Labels are cut at the box's border, and padded to erase the previous ones.
+        for (unsigned x = page.x + 2; x <= page.x + page.width; x++)
+            _tileMap->setTileAndDelta(x, y, (*label != 0) ? *label++ : ' ', delta);
+    }
+    
+    void Menu::_erasePage(const MenuPage& page) const noexcept
+    {
+        eraseFrame(*_tileMap, *_frame, page.x, page.y, page.x + page.width + 1, page.y + page.rows + 1);
+    }
+    
+    std::uint8_t Menu::_deltaOf(const Level& level, unsigned index) const noexcept
+    {
+        if (index == level.selected)
+            return _selectedDelta;
+        return level.page->items[index].disabled ? _disabledDelta : _delta;
+    }
+}
@@ -0,0 +1,118 @@
+#ifndef PTUI_MENU_HPP
+#   define PTUI_MENU_HPP
+
+#   include <cstdint>
+
+#   include "input/Buttons.hpp"
+#   include "ptui/Frames.hpp"
+#   include "ptui/TASTerminalTileMap.hpp"
+
+
+namespace ptui
+{
+    struct MenuPage;
+    
+    struct MenuItem
+    {
+        const char* label;
+        // Opened when the item is chosen, if any.
+        const MenuPage* submenu = nullptr;
+        // Disabled items can be selected, but not chosen.
+        bool disabled = false;
+    };
+    
+    // A list of items in a box, whose top-left corner is at x, y. Its inside is width columns, the cursor's included,
+    // by rows rows. Pages with more items than rows scroll.
+    struct MenuPage
+    {
+        const MenuItem* items;
+        std::uint16_t count;
+        std::uint8_t x;
+        std::uint8_t y;
+        std::uint8_t width;
+        std::uint8_t rows;
+    };
+    
+    enum class MenuAction : std::uint8_t
+    {
+        None,
+        Moved,
+        // A submenu was opened.
+        Opened,
+        // An item without a submenu was chosen: see selectedItem().
+        Chosen,
+        // A submenu was closed, back to its parent.
+        Backed,
+        // The root page was closed.
+        Closed
+    };
+    
+    // A menu drawn on the UI tile map, with nested submenus.
+    // The tile map holds the menu between frames: moving the cursor only rewrites the old and new rows' cursor and deltas,
+    // and scrolling only redraws the visible rows, so a menu's cost doesn't depend on how many items it has.
+    class Menu
+    {
+    public:
+        static constexpr unsigned maxDepth = 4;
+        static constexpr char cursorTile = '>';
+        
+        // The deltas of items, of the selected item and of disabled items.
+        void setDeltas(std::uint8_t delta, std::uint8_t selectedDelta, std::uint8_t disabledDelta) noexcept;
+        
+        // The pages' frame, boxFrame by default. Its inside is left to the items.
+        void setFrame(const FrameStyle& frame) noexcept { _frame = &frame; }
+        
+        // Draws the root page, with the cursor on the given item.
+        void open(TASUITileMap& tileMap, const MenuPage& page, unsigned selected = 0) noexcept;
+        
+        // Erases every page.
+        void close() noexcept;
+        
+        bool isOpen() const noexcept { return _depth > 0; }
+        // 1 for the root page, more in submenus.
+        unsigned depth() const noexcept { return _depth; }
+        const MenuPage& page() const noexcept { return *_levels[_depth - 1].page; }
+        // The selected item of the given level, 0 being the root page.
+        unsigned selected(unsigned level) const noexcept { return _levels[level].selected; }
+        unsigned selected() const noexcept { return _levels[_depth - 1].selected; }
+        const MenuItem& selectedItem() const noexcept { return page().items[selected()]; }
+        
+        // Moves the cursor of the current page, scrolling if needed.
+        void select(unsigned index) noexcept;
+        
+        // Opens the selected item's submenu, or chooses it. Disabled items do nothing.
+        MenuAction choose() noexcept;
+        
+        // Closes the current page.
+        MenuAction back() noexcept;
+        
+        // Up and Down move the cursor, wrapping around, and also follow auto-repeats, see input::Buttons::setRepeat().
+        // A chooses and B goes back.
+        MenuAction handle(const input::Event& event) noexcept;
+    
+    private:
+        struct Level
+        {
+            const MenuPage* page;
+            std::uint16_t selected;
+            // The first visible item.
+            std::uint16_t top;
+        };
+        
+        void _drawPage(const Level& level) const noexcept;
+        void _drawRow(const Level& level, unsigned row) const noexcept;
+        void _erasePage(const MenuPage& page) const noexcept;
+        std::uint8_t _deltaOf(const Level& level, unsigned index) const noexcept;
+        
+        TASUITileMap* _tileMap = nullptr;
+        const FrameStyle* _frame = &boxFrame;
+        Level _levels[maxDepth];
+        unsigned _depth = 0;
+        std::uint8_t _delta = 0;
+        std::uint8_t _selectedDelta = 8;
+        std::uint8_t _disabledDelta = 0;
+    };
+}
+
+
+#endif // PTUI_MENU_HPP
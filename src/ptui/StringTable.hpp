@@ -0,0 +1,152 @@
+#ifndef PTUI_STRINGTABLE_HPP
+#   define PTUI_STRINGTABLE_HPP
+
+#   include <cstddef>
+#   include <cstdint>
+
+#   include "ptui/GlyphRemap.hpp"
+#   include "ptui/UTF8.hpp"
+
+
+namespace ptui
+{
+    // The game's texts, compressed by scripts/StringTableCompiler.cpp with byte pair encoding.
+    // Each code below symbolCount stands for a character, each other code for a pair of codes, so a code can expand
+    // into whole words. Strings are decoded a character at a time by a StringReader and never live in RAM.
+    struct StringTable
+    {
+        // How deep pairs can nest, which bounds a StringReader's stack.
+        static constexpr unsigned maxDepth = 12;
+        
+        std::uint16_t count;
+        std::uint16_t symbolCount;
+        const char* symbols;
+        // The pair of code symbolCount + i is pairs[i].
+        const std::uint8_t (*pairs)[2];
+        // count + 1 offsets: string i's codes are data[offsets[i]] to data[offsets[i + 1]], excluded.
+        const std::uint16_t* offsets;
+        const std::uint8_t* data;
+    };
+    
+    // Decodes a string a character at a time. Readers are small and copyable: a copy reads ahead without moving the original.
+    class StringReader
+    {
+    public:
+        StringReader() noexcept = default;
+        
+        // Reads a plain string, for code taking either.
+        explicit StringReader(const char* text) noexcept :
+            _data(reinterpret_cast<const std::uint8_t*>(text)),
+            _source(text)
+        {
+        }
+        
+        StringReader(const StringTable& table, unsigned id) noexcept :
+            _table(&table),
+            _data(table.data + table.offsets[id]),
+            _end(table.data + table.offsets[id + 1]),
+            _source(_data)
+        {
+        }
+        
+        // The next character, or 0 past the string's end.
+        char next() noexcept
+        {
+            std::uint8_t code;
+            
+            if (_depth > 0)
+                code = _stack[--_depth];
+            else if (_data != _end)
+                code = *_data++;
+            else
+                return 0;
+            if (_table == nullptr)
+            {
+                // Plain strings end on their 0.
+                if (code == 0)
+                    _end = --_data;
+                return code;
+            }
+            // Expands the pair's left side, keeping the right sides for later.
+            for (; code >= _table->symbolCount; code = _table->pairs[code - _table->symbolCount][0])
+                _stack[_depth++] = _table->pairs[code - _table->symbolCount][1];
+            return _table->symbols[code];
+        }
+        
+        // The next character's code point, decoded from UTF-8 as decodeUTF8() does, or 0 past the string's end.
+        std::uint32_t nextCodePoint() noexcept
+        {
+            std::uint8_t lead = next();
+            unsigned length = utf8ContinuationCount(lead);
+            std::uint32_t codePoint = utf8LeadBits(lead, length);
+            StringReader afterLead = *this;
+            
+            for (unsigned i = 0; i < length; i++)
+            {
+                std::uint8_t continuation = next();
+                
+                if ((continuation >> 6) != 0x2)
+                {
+                    *this = afterLead;
+                    return lead;
+                }
+                codePoint = (codePoint << 6) | (continuation & 0x3F);
+            }
+            return codePoint;
+        }
+        
+        // Where the string starts, the same for every reader of a string.
+        const void* source() const noexcept { return _source; }
+    
+    private:
+        const StringTable* _table = nullptr;
+        const std::uint8_t* _data = nullptr;
+        // Null for plain strings, until their 0 is read.
+        const std::uint8_t* _end = nullptr;
+        const void* _source = nullptr;
+        std::uint8_t _stack[StringTable::maxDepth] = {};
+        std::uint8_t _depth = 0;
+    };
+    
+    // Prints a UTF-8 string with a UI tile map's printString(), or printText() to wrap words, decoding a chunk at a time
+    // into the tiles of the tileset's glyphs.
+    template<class TileMapT>
+    void printString(TileMapT& tileMap, const GlyphRemap& glyphs, StringReader reader, bool wrapWords = false) noexcept
+    {
+        constexpr std::size_t chunkSize = 64;
+        char chunk[chunkSize];
+        
+        for (;;)
+        {
+            std::size_t length = 0;
+            std::size_t breakLength = 0;
+            StringReader breakReader;
+            
+            for (std::uint32_t c; (length + 1 < chunkSize) && ((c = reader.nextCodePoint()) != 0);)
+            {
+                chunk[length++] = tileOf(glyphs, c);
+                if (c == ' ')
+                {
+                    breakLength = length;
+                    breakReader = reader;
+                }
+            }
+            if (length == 0)
+                return;
+            // Full chunks end after a space when possible, so printText() doesn't split words.
+            if (wrapWords && (length + 1 == chunkSize) && (breakLength > 0))
+            {
+                length = breakLength;
+                reader = breakReader;
+            }
+            chunk[length] = 0;
+            if (wrapWords)
+                tileMap.printText(chunk);
+            else
+                tileMap.printString(chunk);
+        }
+    }
+}
+
+
+#endif // PTUI_STRINGTABLE_HPP
@@ -10,6 +10,7 @@ namespace ptui
 {
     constexpr unsigned lcdWidth = PROJ_LCDWIDTH;
     constexpr unsigned lcdHeight = PROJ_LCDHEIGHT;
+    // TerminalTileSet's glyph size, which the terminal, TextStrip and ListView all render with.
     constexpr unsigned ttmTileWidth = 6;
     constexpr unsigned ttmTileHeight = 6;
     // Calculates the right number of tiles depending on the screen size.
@@ -0,0 +1,197 @@
+#include "ptui/TextStrip.hpp"
+
+#include <algorithm>
+#include <climits>
+#include <cstring>
+
+#include "ptui/UTF8.hpp"
+
+
+namespace ptui
+{
+    namespace
+    {
+        // The 2bpp value of the tileset's colours: 0 for the background, 1 to 3 for the inks.
+        unsigned inkOf(std::uint8_t color) noexcept
+        {
+            switch (color)
+            {
+            case 6:
+                return 1;
+            
+            case 5:
+                return 2;
+            
+            case 3:
+                return 3;
+            
+            default:
+                return 0;
+            }
+        }
+        
+        bool isBlank(std::uint32_t c) noexcept
+        {
+            return (c == ' ') || (c == '\n');
+        }
+    }
+    
+    void TextStrip::setTilesetImage(const std::uint8_t* tileset, unsigned tileCount, const GlyphRemap& glyphs) noexcept
+    {
+        constexpr unsigned tileWidth = ttmTileWidth;
+        
+        _tileset = tileset;
+        _tileCount = std::min(tileCount, glyphCount);
+        _glyphs = &glyphs;
+        for (unsigned glyph = 0; glyph < _tileCount; glyph++)
+        {
+            const std::uint8_t* pixels = tileset + glyph * tileWidth * glyphHeight;
+            unsigned first = tileWidth;
+            unsigned last = 0;
+            
+            for (unsigned row = 0; row < glyphHeight; row++)
+                for (unsigned column = 0; column < tileWidth; column++)
+                    if (inkOf(pixels[row * tileWidth + column]) != 0)
+                    {
+                        first = std::min(first, column);
+                        last = std::max(last, column);
+                    }
+            // Inked glyphs are followed by a blank column.
+            _glyphFirstColumns[glyph] = (first < tileWidth) ? first : 0;
+            _glyphWidths[glyph] = (first < tileWidth) ? last - first + 2 : blankWidth;
+        }
+        clear();
+    }
+    
+    void TextStrip::setArea(int x, int y, unsigned width, unsigned lines) noexcept
+    {
+        _x = x;
+        _y = y;
+        _width = std::min(width, maxWidth);
+        _lines = std::min(lines, maxLines);
+    }
+    
+    void TextStrip::setColors(std::uint8_t ink, std::uint8_t secondInk, std::uint8_t thirdInk) noexcept
+    {
+        _colors[1] = ink;
+        _colors[2] = secondInk;
+        _colors[3] = thirdInk;
+    }
+    
+    void TextStrip::print(const StringReader& text, int length) noexcept
+    {
+        unsigned end = (length < 0) ? UINT_MAX : length;
+        
+        if ((text.source() != _source) || (end < _printed))
+        {
+            clear();
+            _source = text.source();
+            _reader = text;
+        }
+        for (std::uint32_t c = 0; (_printed < end) && ((c = _reader.nextCodePoint()) != 0); _printed++, _previous = c)
+        {
+            if (c == '\n')
+            {
+                _newLine();
+                continue;
+            }
+            // Wraps words which don't fit on the line, unless they don't fit on any line.
+            if (!isBlank(c) && isBlank(_previous))
+            {
+                unsigned width = _glyphWidths[_tileOf(c)] + _wordWidth(_reader);
+                
+                if ((_penX > 0) && (_penX + width > _width))
+                    _newLine();
+            }
+            _drawGlyph(_tileOf(c));
+        }
+    }
+    
+    void TextStrip::clear() noexcept
+    {
+        std::memset(_pixels, 0, sizeof(_pixels));
+        _reader = StringReader();
+        _source = nullptr;
+        _previous = ' ';
+        _printed = 0;
+        _penX = 0;
+        _line = 0;
+    }
+    
+    void TextStrip::renderIntoLineBuffer(std::uint8_t* line, std::uint32_t y, bool skip) const noexcept
+    {
+        int row = int(y) - _y;
+        
+        if (skip || (row < 0) || (row >= int(_lines * glyphHeight)))
+            return;
+        
+        const std::uint32_t* words = _pixels[row];
+        
+        for (unsigned word = 0; word < (_width + 15) / 16; word++)
+        {
+            std::uint32_t pixels = words[word];
+            int x = _x + word * 16;
+            
+            // Blank words, most of them, cost a single test.
+            for (; pixels != 0; pixels >>= 2, x++)
+                if ((pixels & 3) && (x >= 0) && (x < int(lcdWidth)))
+                    line[x] = _colors[pixels & 3];
+        }
+    }
+    
+    void TextStrip::_newLine() noexcept
+    {
+        _penX = 0;
+        if (++_line < _lines)
+            return;
+        // Scrolls the lines up, to make room for the new one.
+        std::memmove(_pixels[0], _pixels[glyphHeight], (_lines - 1) * glyphHeight * sizeof(_pixels[0]));
+        std::memset(_pixels[(_lines - 1) * glyphHeight], 0, glyphHeight * sizeof(_pixels[0]));
+        _line = _lines - 1;
+    }
+    
+    std::uint8_t TextStrip::_tileOf(std::uint32_t codePoint) const noexcept
+    {
+        std::uint8_t tile = tileOf(*_glyphs, codePoint);
+        
+        return (tile < _tileCount) ? tile : _glyphs->missingTile;
+    }
+    
+    // The width of the rest of the word, read from a copy of the reader.
+    unsigned TextStrip::_wordWidth(StringReader word) const noexcept
+    {
+        unsigned width = 0;
+        
+        for (std::uint32_t c; ((c = word.nextCodePoint()) != 0) && !isBlank(c);)
+            width += _glyphWidths[_tileOf(c)];
+        return width;
+    }
+    
+    void TextStrip::_drawGlyph(unsigned glyph) noexcept
+    {
+        constexpr unsigned tileWidth = ttmTileWidth;
+        unsigned width = _glyphWidths[glyph];
+        
+        // Glyphs past the right edge are dropped.
+        if (_penX + width > _width)
+        {
+            _penX = _width;
+            return;
+        }
+        
+        const std::uint8_t* pixels = _tileset + glyph * tileWidth * glyphHeight + _glyphFirstColumns[glyph];
+        
+        for (unsigned row = 0; row < glyphHeight; row++)
+        {
+            std::uint32_t* words = _pixels[_line * glyphHeight + row];
+            
+            for (unsigned column = 0; (column < width) && (_glyphFirstColumns[glyph] + column < tileWidth); column++)
+            {
+                unsigned x = _penX + column;
+                
+                words[x / 16] |= std::uint32_t(inkOf(pixels[row * tileWidth + column])) << ((x % 16) * 2);
+            }
+        }
+        _penX += width;
+    }
+}
@@ -0,0 +1,82 @@
+#ifndef PTUI_TEXTSTRIP_HPP
+#   define PTUI_TEXTSTRIP_HPP
+
+#   include <cstdint>
+
+#   include "ptui/GlyphRemap.hpp"
+#   include "ptui/StringTable.hpp"
+#   include "ptui/TASTerminalTileMap.hpp"
+
+
+namespace ptui
+{
+    // Proportional text, pre-rendered at 2bpp into a RAM strip as it's printed, and composited over lines with a 4-colour CLUT.
+    // Rendering a line costs the same however much text it holds, and proportional glyphs fit more text than the terminal's cells.
+    // Glyphs come from the terminal's tileset, each trimmed to its inked columns, and texts are UTF-8 mapped to them through
+    // the tileset's GlyphRemap. Words wrap at the strip's width, and the strip scrolls up once full.
+    class TextStrip
+    {
+    public:
+        static constexpr unsigned maxWidth = lcdWidth;
+        static constexpr unsigned glyphHeight = ttmTileHeight;
+        // A tile id is a byte.
+        static constexpr unsigned glyphCount = 256;
+        static constexpr unsigned maxLines = 4;
+        static constexpr unsigned height = maxLines * glyphHeight;
+        // The width of glyphs without ink, e.g. spaces.
+        static constexpr unsigned blankWidth = 3;
+        
+        // Measures the tileCount glyphs of a terminal tileset, whose background is colour 1 and whose inks are colours 3, 5
+        // and 6. Characters print as the tiles the glyphs remap gives them, or as its missing tile past the tileset.
+        void setTilesetImage(const std::uint8_t* tileset, unsigned tileCount, const GlyphRemap& glyphs = asciiGlyphs) noexcept;
+        
+        // The strip's top-left corner on screen, its width in pixels, and its number of lines.
+        void setArea(int x, int y, unsigned width, unsigned lines) noexcept;
+        
+        // The colours of the inks 6, 5 and 3 of the tileset.
+        void setColors(std::uint8_t ink, std::uint8_t secondInk, std::uint8_t thirdInk) noexcept;
+        
+        // Shows the length first characters of the text, or all of it if length is negative.
+        // Printing more of the same text only renders the new characters. Another text, or a shorter one, starts over.
+        void print(const char* text, int length = -1) noexcept { print(StringReader(text), length); }
+        
+        // The same for a string of a StringTable, decoded as it's printed.
+        void print(const StringReader& text, int length = -1) noexcept;
+        
+        void clear() noexcept;
+        
+        // Composites the strip's inked pixels over the line.
+        void renderIntoLineBuffer(std::uint8_t* line, std::uint32_t y, bool skip) const noexcept;
+    
+    private:
+        // 16 pixels per word, the leftmost on the lowest bits.
+        static constexpr unsigned stride = (maxWidth + 15) / 16;
+        
+        void _newLine() noexcept;
+        std::uint8_t _tileOf(std::uint32_t codePoint) const noexcept;
+        unsigned _wordWidth(StringReader word) const noexcept;
+        void _drawGlyph(unsigned glyph) noexcept;
+        
+        std::uint32_t _pixels[height][stride] = {};
+        const std::uint8_t* _tileset = nullptr;
+        unsigned _tileCount = 0;
+        const GlyphRemap* _glyphs = &asciiGlyphs;
+        std::uint8_t _glyphFirstColumns[glyphCount] = {};
+        std::uint8_t _glyphWidths[glyphCount] = {};
+        std::uint8_t _colors[4] = {0, 6, 5, 3};
+        int _x = 0;
+        int _y = 0;
+        unsigned _width = maxWidth;
+        unsigned _lines = maxLines;
+        // Where printing is at.
+        StringReader _reader;
+        const void* _source = nullptr;
+        std::uint32_t _previous = ' ';
+        unsigned _printed = 0;
+        unsigned _penX = 0;
+        unsigned _line = 0;
+    };
+}
+
+
+#endif // PTUI_TEXTSTRIP_HPP
@@ -0,0 +1,146 @@
+#ifndef PTUI_UTF8_HPP
+#   define PTUI_UTF8_HPP
+
+#   include <cassert>
+#   include <cstddef>
+#   include <cstdint>
+
+#   include "ptui/GlyphRemap.hpp"
+
+
+namespace ptui
+{
+    // How many continuation bytes follow a lead byte. None for ASCII and malformed bytes.
+    constexpr unsigned utf8ContinuationCount(std::uint8_t lead) noexcept
+    {
+        return (lead < 0x80) ? 0 : ((lead >> 5) == 0x6) ? 1 : ((lead >> 4) == 0xE) ? 2 : ((lead >> 3) == 0x1E) ? 3 : 0;
+    }
+    
+    // The code point's bits held by a lead byte.
+    constexpr std::uint32_t utf8LeadBits(std::uint8_t lead, unsigned length) noexcept
+    {
+        return (length == 0) ? lead : (length == 1) ? (lead & 0x1F) : (length == 2) ? (lead & 0x0F) : (lead & 0x07);
+    }
+    
+    // Decodes the code point at text[index] and moves index past it. Malformed bytes decode as themselves, one at a time.
+    constexpr std::uint32_t decodeUTF8(const char* text, std::size_t& index) noexcept
+    {
+        std::uint8_t lead = text[index++];
+        unsigned length = utf8ContinuationCount(lead);
+        std::uint32_t codePoint = utf8LeadBits(lead, length);
+        
+        for (unsigned i = 0; i < length; i++)
+        {
+            std::uint8_t continuation = text[index + i];
+            
+            if ((continuation >> 6) != 0x2)
+                return lead;
+            codePoint = (codePoint << 6) | (continuation & 0x3F);
+        }
+        index += length;
+        return codePoint;
+    }
+    
+    namespace details
+    {
+        // Not constexpr, so that reaching it fails a compile-time encoding.
+        inline void controlCodeTile() noexcept
+        {
+            assert(!"The GlyphRemap gave a character tile 0 or 10, which printString() reads as control codes");
+        }
+    }
+    
+    // The tile printing the code point. New lines stay new lines, and the remap must never give a character tile 0 or '\n',
+    // which printString() and printText() read as the string's end and a new line.
+    constexpr char tileOf(const GlyphRemap& glyphs, std::uint32_t codePoint) noexcept
+    {
+        if (codePoint == '\n')
+            return '\n';
+        
+        std::uint8_t tile = glyphs.tileOf(codePoint);
+        
+        if ((tile == 0) || (tile == '\n'))
+            details::controlCodeTile();
+        return tile;
+    }
+    
+    // A text encoded as tiles, ready for printString() and printText(). Never longer than its UTF-8.
+    template<std::size_t capacityP>
+    struct EncodedText
+    {
+        char tiles[capacityP] = {};
+        std::size_t length = 0;
+        
+        constexpr operator const char*() const noexcept { return tiles; }
+    };
+    
+    // Encodes a UTF-8 string literal at compile time, e.g.
+    //     constexpr auto greeting = ptui::encode(TerminalTileSetGlyphs, u8"Ça va ?");
+    //     ptui::tasUITileMap.printString(greeting);
+    template<std::size_t sizeP>
+    constexpr EncodedText<sizeP> encode(const GlyphRemap& glyphs, const char (&text)[sizeP]) noexcept
+    {
+        EncodedText<sizeP> encoded;
+        
+        for (std::size_t index = 0; (index < sizeP) && (text[index] != 0);)
+            encoded.tiles[encoded.length++] = tileOf(glyphs, decodeUTF8(text, index));
+        return encoded;
+    }
+    
+    // Encodes a UTF-8 string at run time, in O(1) per code point, into at most capacity - 1 tiles and a terminating 0.
+    // Returns how many bytes of text were encoded, which is less than its length if the tiles didn't fit.
+    inline std::size_t encode(const GlyphRemap& glyphs, const char* text, char* tiles, std::size_t capacity) noexcept
+    {
+        std::size_t index = 0;
+        std::size_t length = 0;
+        
+        while ((text[index] != 0) && (length + 1 < capacity))
+            tiles[length++] = tileOf(glyphs, decodeUTF8(text, index));
+        tiles[length] = 0;
+        return index;
+    }
+    
+    // Prints a dynamic UTF-8 string with a UI tile map's printString(), or printText() to wrap words, a chunk at a time.
+    // Static strings are better encoded at compile time.
+    template<class TileMapT>
+    void printUTF8(TileMapT& tileMap, const GlyphRemap& glyphs, const char* text, bool wrapWords = false) noexcept
+    {
+        constexpr std::size_t chunkSize = 64;
+        char tiles[chunkSize];
+        
+        while (*text != 0)
+        {
+            std::size_t index = 0;
+            std::size_t length = 0;
+            std::size_t breakIndex = 0;
+            std::size_t breakLength = 0;
+            
+            while ((text[index] != 0) && (length + 1 < chunkSize))
+            {
+                std::uint32_t codePoint = decodeUTF8(text, index);
+                
+                tiles[length++] = tileOf(glyphs, codePoint);
+                if (codePoint == ' ')
+                {
+                    breakIndex = index;
+                    breakLength = length;
+                }
+            }
+            // Chunks end after a space when possible, so printText() doesn't split words.
+            if (wrapWords && (text[index] != 0) && (breakLength > 0))
+            {
+                index = breakIndex;
+                length = breakLength;
+            }
+            tiles[length] = 0;
+            if (wrapWords)
+                tileMap.printText(tiles);
+            else
+                tileMap.printString(tiles);
+            text += index;
+        }
+    }
+}
+
+
+#endif // PTUI_UTF8_HPP
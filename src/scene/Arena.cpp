@@ -0,0 +1,30 @@
+#include "scene/Arena.hpp"
+
+#include <algorithm>
+
+
+namespace scene
+{
+    Arena sceneArena;
+    
+    void* Arena::allocate(std::size_t size, std::size_t alignment) noexcept
+    {
+        std::size_t start = (_used + alignment - 1) & ~(alignment - 1);
+        
+        if ((start > capacity) || (size > capacity - start))
+        {
+            _failures++;
+            return nullptr;
+        }
+        _used = start + size;
+        _scenePeak = std::max(_scenePeak, _used);
+        _peak = std::max(_peak, _used);
+        return _memory + start;
+    }
+    
+    void Arena::reset() noexcept
+    {
+        _used = 0;
+        _scenePeak = 0;
+    }
+}
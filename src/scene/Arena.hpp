@@ -0,0 +1,70 @@
+#ifndef SCENE_ARENA_HPP
+#   define SCENE_ARENA_HPP
+
+#   include <cstddef>
+#   include <cstdint>
+#   include <new>
+#   include <type_traits>
+#   include <utility>
+
+
+namespace scene
+{
+    // A bump allocator for what a scene needs only while it plays: UI windows, text layouts, decoded assets...
+    // Everything is freed at once by reset(), which the scene manager calls when the scene exits, so nothing is ever destroyed.
+    class Arena
+    {
+    public:
+        static constexpr std::size_t capacity = 4096;
+        
+        // Returns size bytes aligned on alignment, or nullptr if the arena is full.
+        void* allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t)) noexcept;
+        
+        // Constructs a T in the arena, or returns nullptr if the arena is full.
+        template<class T, class... ArgsT>
+        T* make(ArgsT&&... args) noexcept
+        {
+            static_assert(std::is_trivially_destructible<T>::value, "Arena objects are never destroyed");
+            
+            void* memory = allocate(sizeof(T), alignof(T));
+            
+            return memory ? new (memory) T(std::forward<ArgsT>(args)...) : nullptr;
+        }
+        
+        // The bytes taken by objects made in this order in an empty arena, alignment included. As the arena is empty when a
+        // scene preloads, a scene whose make() calls are unconditional can check at build time that none of them fails.
+        template<class... ObjectsT>
+        static constexpr std::size_t footprint() noexcept
+        {
+            constexpr std::size_t sizes[] = {sizeof(ObjectsT)...};
+            constexpr std::size_t alignments[] = {alignof(ObjectsT)...};
+            std::size_t used = 0;
+            
+            for (std::size_t i = 0; i < sizeof...(ObjectsT); i++)
+                used = ((used + alignments[i] - 1) & ~(alignments[i] - 1)) + sizes[i];
+            return used;
+        }
+        
+        // Frees everything, and starts a new scene peak.
+        void reset() noexcept;
+        
+        std::size_t used() const noexcept { return _used; }
+        // The most bytes used since the last reset, and since the start.
+        std::size_t scenePeak() const noexcept { return _scenePeak; }
+        std::size_t peak() const noexcept { return _peak; }
+        // Allocations that didn't fit since the start.
+        unsigned failures() const noexcept { return _failures; }
+    
+    private:
+        alignas(std::max_align_t) std::uint8_t _memory[capacity];
+        std::size_t _used = 0;
+        std::size_t _scenePeak = 0;
+        std::size_t _peak = 0;
+        unsigned _failures = 0;
+    };
+    
+    extern Arena sceneArena;
+}
+
+
+#endif // SCENE_ARENA_HPP
@@ -0,0 +1,61 @@
+#include "scene/FrameScheduler.hpp"
+
+#include <algorithm>
+
+#ifdef POKITTO
+#   include "mbed.h"
+#else
+#   include <chrono>
+#endif
+
+
+namespace scene
+{
+    FrameScheduler frameScheduler;
+    
+    std::uint32_t FrameScheduler::now() noexcept
+    {
+#ifdef POKITTO
+        return us_ticker_read();
+#else
+        using namespace std::chrono;
+        
+        return duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+#endif
+    }
+    
+    bool FrameScheduler::post(Job job, void* context) noexcept
+    {
+        for (unsigned i = 0; i < _count; i++)
+            if ((_jobs[i].job == job) && (_jobs[i].context == context))
+                return true;
+        if (_count == capacity)
+            return false;
+        _jobs[_count++] = {job, context};
+        return true;
+    }
+    
+    void FrameScheduler::beginFrame(std::uint32_t renderTime) noexcept
+    {
+        _deadline = now() + _framePeriod - std::min(renderTime, _framePeriod);
+    }
+    
+    void FrameScheduler::run() noexcept
+    {
+        bool starved = _starvedFrames >= maxStarvedFrames;
+        bool ran = false;
+        
+        // Wrapping differences, as the clock wraps every 71 minutes.
+        while ((_count > 0) && (starved || (std::int32_t(_deadline - now()) > 0)))
+        {
+            if (_jobs[0].job(_jobs[0].context))
+            {
+                _count--;
+                std::copy(_jobs + 1, _jobs + 1 + _count, _jobs);
+            }
+            starved = false;
+            ran = true;
+        }
+        _starvedFrames = (ran || (_count == 0)) ? 0 : _starvedFrames + 1;
+    }
+}
@@ -0,0 +1,63 @@
+#ifndef SCENE_FRAMESCHEDULER_HPP
+#   define SCENE_FRAMESCHEDULER_HPP
+
+#   include <cstdint>
+
+
+namespace scene
+{
+    // A deferrable job. Does a bounded slice of work per call, and returns true once done.
+    using Job = bool (*)(void* context) noexcept;
+    
+    // Runs deferrable jobs with whatever time is left in each frame, carrying the rest over to the next frames.
+    // Jobs run in the order they were posted, one at a time.
+    class FrameScheduler
+    {
+    public:
+        static constexpr unsigned capacity = 16;
+        // A job waiting for this many frames without any time left gets a slice anyway.
+        static constexpr unsigned maxStarvedFrames = 8;
+        
+        // Microseconds since an arbitrary origin.
+        static std::uint32_t now() noexcept;
+        
+        // The frame rate the budget is computed for. scene::play() sets it to PROJ_TARGET_FPS.
+        void setTargetFPS(unsigned fps) noexcept { _framePeriod = 1000000 / fps; }
+        
+        // The target frame rate's period, in microseconds.
+        std::uint32_t framePeriod() const noexcept { return _framePeriod; }
+        
+        // Queues the job, unless it's already pending with the same context. Returns false if the queue is full.
+        bool post(Job job, void* context) noexcept;
+        
+        // Forgets every pending job. scene::play() calls it when a scene exits, as the jobs worked for it.
+        void clear() noexcept { _count = 0; }
+        
+        unsigned pending() const noexcept { return _count; }
+        
+        // Starts the frame's budget, right after a frame was rendered in renderTime microseconds.
+        // The next frame is expected to take as long to render.
+        void beginFrame(std::uint32_t renderTime) noexcept;
+        
+        // Runs pending jobs until the frame's budget is spent.
+        void run() noexcept;
+    
+    private:
+        struct Entry
+        {
+            Job job;
+            void* context;
+        };
+        
+        Entry _jobs[capacity];
+        unsigned _count = 0;
+        std::uint32_t _framePeriod = 1000000 / 50;
+        std::uint32_t _deadline = 0;
+        unsigned _starvedFrames = 0;
+    };
+    
+    extern FrameScheduler frameScheduler;
+}
+
+
+#endif // SCENE_FRAMESCHEDULER_HPP
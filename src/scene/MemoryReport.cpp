@@ -0,0 +1,61 @@
+#include "scene/MemoryReport.hpp"
+
+#include <cstdio>
+
+#include "gfx/TASSpriteBatch.hpp"
+#include "input/Buttons.hpp"
+#include "input/Recorder.hpp"
+#include "ptui/TASTerminalTileMap.hpp"
+#include "scene/Arena.hpp"
+#include "scene/FrameScheduler.hpp"
+#include "scene/QualityGovernor.hpp"
+#include "world/ChunkStreamer.hpp"
+#include "world/MapRegistry.hpp"
+
+
+namespace scene
+{
+    namespace
+    {
+        struct MemoryUsage
+        {
+            const char* name;
+            std::size_t bytes;
+        };
+        
+        constexpr MemoryUsage staticUsages[] =
+        {
+            {"ptui::tasUITileMap", sizeof(ptui::tasUITileMap)},
+            {"gfx::tasSpriteBatch", sizeof(gfx::tasSpriteBatch)},
+            {"world::chunkStreamer", sizeof(world::chunkStreamer)},
+            {"world::mapRegistry", sizeof(world::mapRegistry)},
+            {"scene::sceneArena", sizeof(sceneArena)},
+            {"scene::frameScheduler", sizeof(frameScheduler)},
+            {"scene::qualityGovernor", sizeof(qualityGovernor)},
+            {"input::buttons", sizeof(input::buttons)},
+            {"input::recorder", sizeof(input::recorder)},
+        };
+        
+        constexpr std::size_t staticTotal() noexcept
+        {
+            std::size_t total = 0;
+            
+            for (auto& usage : staticUsages)
+                total += usage.bytes;
+            return total;
+        }
+        
+        static_assert(staticTotal() <= staticRAMBudget, "The subsystems' globals outgrew staticRAMBudget");
+    }
+    
+    void printMemoryReport(const char* title) noexcept
+    {
+        std::printf("Memory report: %s\n", title);
+        for (auto& usage : staticUsages)
+            std::printf("  %-24s %6u bytes\n", usage.name, unsigned(usage.bytes));
+        std::printf("  %-24s %6u / %u bytes\n", "static total", unsigned(staticTotal()), unsigned(staticRAMBudget));
+        std::printf("  %-24s %6u / %u bytes, peak %u, all-time peak %u, %u failed allocations\n", "scene arena",
+                    unsigned(sceneArena.used()), unsigned(Arena::capacity), unsigned(sceneArena.scenePeak()),
+                    unsigned(sceneArena.peak()), sceneArena.failures());
+    }
+}
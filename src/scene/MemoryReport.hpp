@@ -0,0 +1,19 @@
+#ifndef SCENE_MEMORYREPORT_HPP
+#   define SCENE_MEMORYREPORT_HPP
+
+#   include <cstddef>
+
+
+namespace scene
+{
+    // The RAM the subsystems' globals may take, checked at build time.
+    // The rest of the 36KB goes to PokittoLib (TASMODE's line buffers among others), the scenes, the stack and the heap.
+    constexpr std::size_t staticRAMBudget = 16 * 1024;
+    
+    // Prints the RAM each subsystem reserves statically, and the scene arena's usage, to stdout.
+    // On Desktop, scene::play() prints one as each scene exits, before the arena is reset.
+    void printMemoryReport(const char* title) noexcept;
+}
+
+
+#endif // SCENE_MEMORYREPORT_HPP
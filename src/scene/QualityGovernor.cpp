@@ -0,0 +1,67 @@
+#include "scene/QualityGovernor.hpp"
+
+
+namespace scene
+{
+    QualityGovernor qualityGovernor;
+    
+    void QualityGovernor::setVariants(unsigned layer, const TAS::LineFiller* variants, unsigned count) noexcept
+    {
+        auto& entry = _layers[layer];
+        
+        entry.variants = variants;
+        entry.count = count;
+        if (entry.level >= count)
+            entry.level = 0;
+    }
+    
+    void QualityGovernor::clear() noexcept
+    {
+        for (auto& layer : _layers)
+            layer = Layer();
+        _overBudgetFrames = 0;
+        _headroomFrames = 0;
+    }
+    
+    void QualityGovernor::update(std::uint32_t frameTime, std::uint32_t budget) noexcept
+    {
+        if (frameTime > budget)
+        {
+            _headroomFrames = 0;
+            if (++_overBudgetFrames < degradeAfter)
+                return;
+            _overBudgetFrames = 0;
+            for (unsigned i = fillerCount; i-- > 0;)
+                if (_layers[i].level + 1 < _layers[i].count)
+                {
+                    _layers[i].level++;
+                    return;
+                }
+        }
+        else if (frameTime * 100 < budget * headroomPercent)
+        {
+            _overBudgetFrames = 0;
+            if (++_headroomFrames < restoreAfter)
+                return;
+            _headroomFrames = 0;
+            for (auto& layer : _layers)
+                if (layer.level > 0)
+                {
+                    layer.level--;
+                    return;
+                }
+        }
+        else
+        {
+            _overBudgetFrames = 0;
+            _headroomFrames = 0;
+        }
+    }
+    
+    TAS::LineFiller QualityGovernor::filler(unsigned layer, TAS::LineFiller filler) const noexcept
+    {
+        const auto& entry = _layers[layer];
+        
+        return (entry.count > 0) ? entry.variants[entry.level] : filler;
+    }
+}
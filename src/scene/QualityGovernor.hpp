@@ -0,0 +1,55 @@
+#ifndef SCENE_QUALITYGOVERNOR_HPP
+#   define SCENE_QUALITYGOVERNOR_HPP
+
+#   include "scene/Scene.hpp"
+
+
+namespace scene
+{
+    // Trades rendering quality for frame time. Each layer can have variants of its filler, from the best to the cheapest.
+    // While frames take longer than the budget, layers step down to cheaper variants, the top layer first.
+    // Once frames have enough headroom again, they step back up, the bottom layer first.
+    // scene::play() feeds it each frame the scene plays, and asks it for the fillers it installs.
+    class QualityGovernor
+    {
+    public:
+        // Consecutive frames over budget before stepping down.
+        static constexpr unsigned degradeAfter = 4;
+        // Consecutive frames with headroom before stepping up. Long enough not to oscillate around the budget.
+        static constexpr unsigned restoreAfter = 60;
+        // A frame has headroom when it takes less than this percentage of the budget.
+        static constexpr unsigned headroomPercent = 75;
+        
+        // The layer's variants, which must outlive their use. Keeps the layer's level if it's still valid.
+        void setVariants(unsigned layer, const TAS::LineFiller* variants, unsigned count) noexcept;
+        
+        // Forgets every layer's variants and levels. scene::play() calls it when a scene exits, as they belonged to it.
+        void clear() noexcept;
+        
+        // Feeds the time a frame took to render and update, in microseconds, against the budget.
+        void update(std::uint32_t frameTime, std::uint32_t budget) noexcept;
+        
+        // The layer's variant for its current level, or the given filler if the layer has no variants.
+        TAS::LineFiller filler(unsigned layer, TAS::LineFiller filler) const noexcept;
+        
+        // 0 for the best variant.
+        unsigned level(unsigned layer) const noexcept { return _layers[layer].level; }
+    
+    private:
+        struct Layer
+        {
+            const TAS::LineFiller* variants = nullptr;
+            std::uint8_t count = 0;
+            std::uint8_t level = 0;
+        };
+        
+        Layer _layers[fillerCount];
+        unsigned _overBudgetFrames = 0;
+        unsigned _headroomFrames = 0;
+    };
+    
+    extern QualityGovernor qualityGovernor;
+}
+
+
+#endif // SCENE_QUALITYGOVERNOR_HPP
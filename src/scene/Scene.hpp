@@ -0,0 +1,39 @@
+#ifndef SCENE_SCENE_HPP
+#   define SCENE_SCENE_HPP
+
+#   include "Pokitto.h"
+
+
+namespace scene
+{
+    // As many as PROJ_LINE_FILLERS.
+    constexpr unsigned fillerCount = 3;
+    
+    // A scene of the game, played by scene::play().
+    class Scene
+    {
+    public:
+        // The line fillers the scene renders with. They're installed between two frames, after each update().
+        TAS::LineFiller fillers[fillerCount] = {TAS::NOPFiller, TAS::NOPFiller, TAS::NOPFiller};
+        
+        // Called once per frame while the screen is hidden by the transition's curtain, with the number of previous calls,
+        // until it returns true. Heavy setup (tiles, text layout, CLUT) should be split into steps which fit in a frame.
+        // What the scene needs only while it plays is best allocated from the sceneArena, which is reset after exit().
+        virtual bool preload(unsigned step) noexcept = 0;
+        
+        // Called once preloaded, right before the curtain opens. Button events from before are cleared.
+        virtual void enter() noexcept {}
+        
+        // Called once per frame, while the curtain opens too. Returns false when the scene is over.
+        virtual bool update() noexcept = 0;
+        
+        // Called once the curtain is closed on the scene.
+        virtual void exit() noexcept {}
+    
+    protected:
+        ~Scene() = default;
+    };
+}
+
+
+#endif // SCENE_SCENE_HPP
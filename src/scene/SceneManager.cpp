@@ -0,0 +1,141 @@
+#include "scene/SceneManager.hpp"
+
+#include <algorithm>
+#include <cstdio>
+
+#include "input/Buttons.hpp"
+#include "input/Recorder.hpp"
+#include "scene/Arena.hpp"
+#include "scene/FrameScheduler.hpp"
+#include "scene/MemoryReport.hpp"
+#include "scene/QualityGovernor.hpp"
+
+
+namespace scene
+{
+    namespace
+    {
+        enum class State
+        {
+            Preloading,
+            Opening,
+            Playing,
+            Closing
+        };
+        
+        // The fillers behind the curtain, and how many lines it leaves open on each side of the screen's middle.
+        TAS::LineFiller curtainFillers[fillerCount];
+        int curtainOpening = 0;
+        
+        void CurtainFiller(std::uint8_t* line, std::uint32_t y, bool skip) noexcept
+        {
+            constexpr int middle = PROJ_LCDHEIGHT / 2;
+            bool hidden = (int(y) < middle - curtainOpening) || (int(y) >= middle + curtainOpening);
+            
+            for (auto filler : curtainFillers)
+                filler(line, y, skip || hidden);
+            if (hidden)
+                std::fill(line, line + PROJ_LCDWIDTH, 0);
+        }
+        
+        void installFillers(State state, const Scene& scene) noexcept
+        {
+            using PD=Pokitto::Display;
+            
+            for (unsigned i = 0; i < fillerCount; i++)
+            {
+                // A scene being preloaded isn't ready to render anything.
+                auto filler = (state == State::Preloading) ? TAS::NOPFiller : qualityGovernor.filler(i, scene.fillers[i]);
+                
+                if (state == State::Playing)
+                    PD::lineFillers[i] = filler;
+                else
+                {
+                    curtainFillers[i] = filler;
+                    PD::lineFillers[i] = (i == 0) ? CurtainFiller : TAS::NOPFiller;
+                }
+            }
+        }
+    }
+    
+    void play(Scene* const* scenes, unsigned count) noexcept
+    {
+        using PC=Pokitto::Core;
+        
+        unsigned index = 0;
+        unsigned step = 0;
+        State state = State::Preloading;
+        
+        frameScheduler.setTargetFPS(PROJ_TARGET_FPS);
+        curtainOpening = 0;
+        installFillers(state, *scenes[index]);
+        while (PC::isRunning())
+        {
+            auto renderStart = FrameScheduler::now();
+            
+            if (!PC::update())
+                continue;
+            
+            auto renderTime = FrameScheduler::now() - renderStart;
+            
+            input::buttons.sample(input::recorder.filter(input::Buttons::read()));
+            
+            auto updateStart = FrameScheduler::now();
+            Scene& scene = *scenes[index];
+            
+            frameScheduler.beginFrame(renderTime);
+            
+            switch (state)
+            {
+            case State::Preloading:
+                if (scene.preload(step++))
+                {
+                    // Presses from before the scene could see them aren't meant for it.
+                    input::buttons.clearEvents();
+                    scene.enter();
+                    state = State::Opening;
+                }
+                break;
+            
+            case State::Opening:
+            case State::Playing:
+                if (!scene.update())
+                {
+                    state = State::Closing;
+                    break;
+                }
+                // The scheduler's jobs use up the spare time on purpose, so they don't count.
+                qualityGovernor.update(renderTime + FrameScheduler::now() - updateStart, frameScheduler.framePeriod());
+                if ((state == State::Opening) && ((curtainOpening += curtainSpeed) >= PROJ_LCDHEIGHT / 2))
+                    state = State::Playing;
+                break;
+            
+            case State::Closing:
+                if ((curtainOpening -= curtainSpeed) <= 0)
+                {
+                    curtainOpening = 0;
+                    scene.exit();
+#ifdef DESKTOP
+                    char title[32];
+                    
+                    std::snprintf(title, sizeof(title), "scene %u exited", index);
+                    printMemoryReport(title);
+#endif
+                    // Behind the closed curtain, the recording's SD card write doesn't disturb any measured frame.
+                    input::recorder.flush();
+                    frameScheduler.clear();
+                    qualityGovernor.clear();
+                    sceneArena.reset();
+                    index = (index + 1) % count;
+                    step = 0;
+                    state = State::Preloading;
+                }
+                break;
+            }
+            
+            // Everything the next frame renders is decided here, between two frames.
+            installFillers(state, *scenes[index]);
+            frameScheduler.run();
+        }
+    }
+}
@@ -0,0 +1,19 @@
+#ifndef SCENE_SCENEMANAGER_HPP
+#   define SCENE_SCENEMANAGER_HPP
+
+#   include "scene/Scene.hpp"
+
+
+namespace scene
+{
+    // How many lines the transition's curtain opens or closes by, per frame and per side.
+    constexpr int curtainSpeed = 8;
+    
+    // Plays the scenes one after the other, in a loop, while the Pokitto is running.
+    // Each frame samples the buttons, updates the scene, installs its fillers, then runs the frameScheduler's jobs.
+    // Between two scenes, a curtain closes on the finished one, and opens on the next one once it's preloaded.
+    void play(Scene* const* scenes, unsigned count) noexcept;
+}
+
+
+#endif // SCENE_SCENEMANAGER_HPP
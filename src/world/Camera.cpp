@@ -0,0 +1,43 @@
+#include "world/Camera.hpp"
+
+#include "Pokitto.h"
+
+
+namespace world
+{
+    namespace
+    {
+        // Closes part of the distance, or all of it once the part rounds to nothing, so the camera settles exactly on the target.
+        // Divisions rather than shifts, so the camera settles the same way in every direction.
+        Fixed approach(Fixed position, Fixed target, Fixed divisor) noexcept
+        {
+            Fixed step = (target - position) / divisor;
+            
+            return (step != 0) ? position + step : target;
+        }
+    }
+    
+    void Camera::snap(int targetX, int targetY) noexcept
+    {
+        _x = toFixed(targetX);
+        _y = toFixed(targetY);
+    }
+    
+    void Camera::follow(int targetX, int targetY) noexcept
+    {
+        Fixed divisor = Fixed(1) << _smoothing;
+        
+        _x = approach(_x, toFixed(targetX), divisor);
+        _y = approach(_y, toFixed(targetY), divisor);
+    }
+    
+    int Camera::left() const noexcept
+    {
+        return centerX() - PROJ_LCDWIDTH / 2;
+    }
+    
+    int Camera::top() const noexcept
+    {
+        return centerY() - PROJ_LCDHEIGHT / 2;
+    }
+}
@@ -0,0 +1,38 @@
+#ifndef WORLD_CAMERA_HPP
+#   define WORLD_CAMERA_HPP
+
+#   include "world/Fixed.hpp"
+
+
+namespace world
+{
+    // Follows a target with some lag, and gives the top-left of the screen for drawing.
+    class Camera
+    {
+    public:
+        // The camera closes 1/2^smoothing of its distance to the target each frame. 0 follows it exactly.
+        explicit Camera(unsigned smoothing = 3) noexcept : _smoothing(smoothing) {}
+        
+        // Centers the camera on the target (in pixels) immediately, e.g. when entering a map.
+        void snap(int targetX, int targetY) noexcept;
+        
+        // Moves the camera towards the target, in pixels. Called once per frame.
+        void follow(int targetX, int targetY) noexcept;
+        
+        // The screen's center, in pixels.
+        int centerX() const noexcept { return toPixels(_x); }
+        int centerY() const noexcept { return toPixels(_y); }
+        
+        // The screen's top-left corner, in pixels, as drawn by Tilemap.
+        int left() const noexcept;
+        int top() const noexcept;
+    
+    private:
+        Fixed _x = 0;
+        Fixed _y = 0;
+        unsigned _smoothing;
+    };
+}
+
+
+#endif // WORLD_CAMERA_HPP
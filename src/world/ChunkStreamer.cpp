@@ -0,0 +1,235 @@
+#include "world/ChunkStreamer.hpp"
+
+#include <cstdlib>
+#include <cstring>
+
+
+namespace world
+{
+    ChunkStreamer chunkStreamer;
+    
+    namespace
+    {
+        // Slots in decoding order, from the center outwards.
+        constexpr std::uint8_t slotOrder[ChunkStreamer::windowSlots] = {4, 1, 3, 5, 7, 0, 2, 6, 8};
+        
+        int floorDiv(int value, int divisor) noexcept
+        {
+            return (value >= 0) ? value / divisor : -((-value + divisor - 1) / divisor);
+        }
+        
+        void decodeRLE(const std::uint8_t* rle, std::uint8_t* destination) noexcept
+        {
+            unsigned cell = 0;
+            
+            while (cell < chunkCells)
+            {
+                auto run = rle[0];
+                auto value = rle[1];
+                
+                rle += 2;
+                for (; run > 0; run--, cell++)
+                    destination[(cell / chunkSize) * ChunkStreamer::windowSize + cell % chunkSize] = value;
+            }
+        }
+        
+        void decodeRLENibbles(const std::uint8_t* rle, std::uint8_t* destination) noexcept
+        {
+            unsigned cell = 0;
+            
+            while (cell < chunkCells)
+            {
+                auto run = rle[0];
+                auto value = rle[1];
+                
+                rle += 2;
+                for (; run > 0; run--, cell++)
+                {
+                    auto& pair = destination[(cell / chunkSize) * ChunkStreamer::eventStride + (cell % chunkSize) / 2];
+                    
+                    pair = (cell & 1) ? (pair & 0x0F) | (value << 4) : (pair & 0xF0) | value;
+                }
+            }
+        }
+        
+        void fillChunk(std::uint8_t* destination, unsigned stride, unsigned width, std::uint8_t value) noexcept
+        {
+            for (unsigned y = 0; y < chunkSize; y++)
+                std::memset(destination + y * stride, value, width);
+        }
+        
+        // Moves the plane's content so that byte (x, y) receives byte (x + dx, y + dy).
+        void shiftPlane(std::uint8_t* plane, int stride, int dx, int dy) noexcept
+        {
+            constexpr int rows = ChunkStreamer::windowSize;
+            int length = stride - std::abs(dx);
+            int sourceColumn = (dx > 0) ? dx : 0;
+            int destinationColumn = (dx < 0) ? -dx : 0;
+            
+            if (dy >= 0)
+            {
+                for (int y = 0; y + dy < rows; y++)
+                    std::memmove(plane + y * stride + destinationColumn, plane + (y + dy) * stride + sourceColumn, length);
+            }
+            else
+            {
+                for (int y = rows - 1; y + dy >= 0; y--)
+                    std::memmove(plane + y * stride + destinationColumn, plane + (y + dy) * stride + sourceColumn, length);
+            }
+        }
+    }
+    
+    void ChunkStreamer::setMap(const ChunkedMapData& map, int focusX, int focusY) noexcept
+    {
+        _map = &map;
+        _originChunkX = floorDiv(focusX, PROJ_TILE_W * chunkSize) - 1;
+        _originChunkY = floorDiv(focusY, PROJ_TILE_H * chunkSize) - 1;
+        for (unsigned slot = 0; slot < windowSlots; slot++)
+            _decodeSlot(slot);
+        _pendingSlots = 0;
+    }
+    
+    void ChunkStreamer::clear() noexcept
+    {
+        _map = nullptr;
+        _pendingSlots = 0;
+    }
+    
+    void ChunkStreamer::update(int focusX, int focusY) noexcept
+    {
+        if (_map == nullptr)
+            return;
+        _recenter(floorDiv(focusX, PROJ_TILE_W * chunkSize) - 1, floorDiv(focusY, PROJ_TILE_H * chunkSize) - 1);
+        if (_pendingSlots == 0)
+            return;
+        
+        // Chunks visible on screen can't wait.
+        int firstX = floorDiv(focusX - PROJ_LCDWIDTH / 2, PROJ_TILE_W * chunkSize) - _originChunkX;
+        int lastX = floorDiv(focusX + PROJ_LCDWIDTH / 2, PROJ_TILE_W * chunkSize) - _originChunkX;
+        int firstY = floorDiv(focusY - PROJ_LCDHEIGHT / 2, PROJ_TILE_H * chunkSize) - _originChunkY;
+        int lastY = floorDiv(focusY + PROJ_LCDHEIGHT / 2, PROJ_TILE_H * chunkSize) - _originChunkY;
+        unsigned budget = chunksPerUpdate;
+        
+        for (auto slot : slotOrder)
+        {
+            if ((_pendingSlots & (1 << slot)) == 0)
+                continue;
+            
+            int slotX = slot % windowChunks;
+            int slotY = slot / windowChunks;
+            bool visible = (slotX >= firstX) && (slotX <= lastX) && (slotY >= firstY) && (slotY <= lastY);
+            
+            if (visible || (budget > 0))
+            {
+                if (!visible)
+                    budget--;
+                _decodeSlot(slot);
+                _pendingSlots &= ~(1 << slot);
+            }
+        }
+    }
+    
+    void ChunkStreamer::bind(Tilemap& tilemap) const noexcept
+    {
+        tilemap.set(windowSize, windowSize, _tiles);
+    }
+    
+    void ChunkStreamer::draw(Tilemap& tilemap, int cameraX, int cameraY) const noexcept
+    {
+        tilemap.draw(-(cameraX - _originChunkX * int(chunkSize * PROJ_TILE_W)), -(cameraY - _originChunkY * int(chunkSize * PROJ_TILE_H)));
+    }
+    
+    std::uint8_t ChunkStreamer::tileAt(int tileX, int tileY) noexcept
+    {
+        unsigned index;
+        
+        return _ensureCell(tileX, tileY, index) ? _tiles[index] : emptyTile;
+    }
+    
+    std::uint8_t ChunkStreamer::eventAt(int tileX, int tileY) noexcept
+    {
+        unsigned index;
+        
+        if (!_ensureCell(tileX, tileY, index))
+            return 0;
+        
+        auto pair = _events[index / 2];
+        
+        return (index & 1) ? pair >> 4 : pair & 0x0F;
+    }
+    
+    void ChunkStreamer::_recenter(int chunkX, int chunkY) noexcept
+    {
+        int dx = chunkX - _originChunkX;
+        int dy = chunkY - _originChunkY;
+        
+        if ((dx == 0) && (dy == 0))
+            return;
+        _originChunkX = chunkX;
+        _originChunkY = chunkY;
+        if ((std::abs(dx) >= int(windowChunks)) || (std::abs(dy) >= int(windowChunks)))
+        {
+            // Teleported, nothing can be reused.
+            _pendingSlots = (1 << windowSlots) - 1;
+            return;
+        }
+        shiftPlane(_tiles, windowSize, dx * int(chunkSize), dy * int(chunkSize));
+        shiftPlane(_events, eventStride, dx * int(chunkSize) / 2, dy * int(chunkSize));
+        
+        std::uint16_t pendingSlots = 0;
+        
+        for (int slotY = 0; slotY < int(windowChunks); slotY++)
+            for (int slotX = 0; slotX < int(windowChunks); slotX++)
+            {
+                int sourceX = slotX + dx;
+                int sourceY = slotY + dy;
+                bool reused = (sourceX >= 0) && (sourceX < int(windowChunks)) && (sourceY >= 0) && (sourceY < int(windowChunks));
+                
+                if (!reused || (_pendingSlots & (1 << (sourceY * windowChunks + sourceX))))
+                    pendingSlots |= 1 << (slotY * windowChunks + slotX);
+            }
+        _pendingSlots = pendingSlots;
+    }
+    
+    void ChunkStreamer::_decodeSlot(unsigned slot) noexcept
+    {
+        unsigned slotX = slot % windowChunks;
+        unsigned slotY = slot / windowChunks;
+        int chunkX = _originChunkX + slotX;
+        int chunkY = _originChunkY + slotY;
+        std::uint8_t* tiles = _tiles + slotY * chunkSize * windowSize + slotX * chunkSize;
+        std::uint8_t* events = _events + slotY * chunkSize * eventStride + slotX * chunkSize / 2;
+        
+        if ((chunkX < 0) || (chunkY < 0) || (chunkX >= _map->chunkColumns) || (chunkY >= _map->chunkRows))
+        {
+            fillChunk(tiles, windowSize, chunkSize, emptyTile);
+            fillChunk(events, eventStride, chunkSize / 2, 0);
+            return;
+        }
+        
+        unsigned chunk = chunkY * _map->chunkColumns + chunkX;
+        
+        decodeRLE(_map->tileChunks[chunk], tiles);
+        decodeRLENibbles(_map->eventChunks[chunk], events);
+    }
+    
+    bool ChunkStreamer::_ensureCell(int tileX, int tileY, unsigned& index) noexcept
+    {
+        int x = tileX - _originChunkX * int(chunkSize);
+        int y = tileY - _originChunkY * int(chunkSize);
+        
+        if ((_map == nullptr) || (x < 0) || (y < 0) || (x >= int(windowSize)) || (y >= int(windowSize)))
+            return false;
+        
+        unsigned slot = (y / chunkSize) * windowChunks + x / chunkSize;
+        
+        // Collisions can't wait for the chunk to be streamed in.
+        if (_pendingSlots & (1 << slot))
+        {
+            _decodeSlot(slot);
+            _pendingSlots &= ~(1 << slot);
+        }
+        index = y * windowSize + x;
+        return true;
+    }
+}
@@ -0,0 +1,64 @@
+#ifndef WORLD_CHUNKSTREAMER_HPP
+#   define WORLD_CHUNKSTREAMER_HPP
+
+#   include "Pokitto.h"
+#   include <Tilemap.hpp>
+
+#   include "world/ChunkedMapData.hpp"
+
+
+namespace world
+{
+    // Keeps the windowChunks x windowChunks chunks around a focus point decoded in RAM.
+    // The window is a plain row-major tile map, so Tilemap draws it directly and collisions read from it.
+    class ChunkStreamer
+    {
+    public:
+        static constexpr unsigned windowChunks = 3;
+        static constexpr unsigned windowSize = windowChunks * chunkSize;
+        static constexpr unsigned windowSlots = windowChunks * windowChunks;
+        // The window's events are packed on 4 bits, two cells per byte.
+        static constexpr unsigned eventStride = windowSize / 2;
+        // How many off-screen chunks are decoded per update(), to spread decoding across frames.
+        static constexpr unsigned chunksPerUpdate = 1;
+        
+        // Starts streaming a map, decoding the whole window around the focus point (in pixels).
+        void setMap(const ChunkedMapData& map, int focusX, int focusY) noexcept;
+        
+        // Stops streaming. Lookups return 0 until the next setMap().
+        void clear() noexcept;
+        
+        // Recenters the window on the focus point (in pixels) and decodes pending chunks.
+        // Chunks overlapping the screen around the focus point are decoded immediately, the others chunksPerUpdate at a time.
+        void update(int focusX, int focusY) noexcept;
+        
+        // Makes the Tilemap render the window.
+        void bind(Tilemap& tilemap) const noexcept;
+        
+        // Draws the window, with the top-left of the screen at (cameraX, cameraY) in pixels.
+        void draw(Tilemap& tilemap, int cameraX, int cameraY) const noexcept;
+        
+        // Returns the tile / event at the given tile coordinates, or emptyTile / 0 if outside of the window.
+        std::uint8_t tileAt(int tileX, int tileY) noexcept;
+        std::uint8_t eventAt(int tileX, int tileY) noexcept;
+        
+    private:
+        void _recenter(int chunkX, int chunkY) noexcept;
+        void _decodeSlot(unsigned slot) noexcept;
+        bool _ensureCell(int tileX, int tileY, unsigned& index) noexcept;
+        
+        const ChunkedMapData* _map = nullptr;
+        // Coordinates of the window's top-left chunk, in chunks.
+        int _originChunkX = 0;
+        int _originChunkY = 0;
+        // One bit per window slot whose chunk still needs to be decoded.
+        std::uint16_t _pendingSlots = 0;
+        std::uint8_t _tiles[windowSize * windowSize];
+        std::uint8_t _events[eventStride * windowSize];
+    };
+    
+    extern ChunkStreamer chunkStreamer;
+}
+
+
+#endif // WORLD_CHUNKSTREAMER_HPP
@@ -0,0 +1,32 @@
+#ifndef WORLD_CHUNKEDMAPDATA_HPP
+#   define WORLD_CHUNKEDMAPDATA_HPP
+
+#   include <cstdint>
+
+
+namespace world
+{
+    // Side of a chunk, in tiles.
+    constexpr unsigned chunkSize = 16;
+    constexpr unsigned chunkCells = chunkSize * chunkSize;
+    // The tile of empty cells and of cells past the map's edges. It's never registered, so Tilemap leaves it blank.
+    constexpr std::uint8_t emptyTile = 0xFF;
+    
+    // A map split into chunkSize x chunkSize chunks, as emitted by the TMX converter.
+    // Each chunk is RLE-encoded as (run, value) pairs covering exactly chunkCells cells, in row-major order.
+    struct ChunkedMapData
+    {
+        // Size of the map, in tiles.
+        std::uint16_t width;
+        std::uint16_t height;
+        // Size of the map, in chunks.
+        std::uint16_t chunkColumns;
+        std::uint16_t chunkRows;
+        // Row-major tables of chunkColumns * chunkRows chunks.
+        const std::uint8_t* const* tileChunks;
+        const std::uint8_t* const* eventChunks;
+    };
+}
+
+
+#endif // WORLD_CHUNKEDMAPDATA_HPP
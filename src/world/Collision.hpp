@@ -0,0 +1,104 @@
+#ifndef WORLD_COLLISION_HPP
+#   define WORLD_COLLISION_HPP
+
+#   include "Pokitto.h"
+
+#   include <cstdint>
+
+
+namespace world
+{
+    // An axis-aligned box, in pixels.
+    struct Box
+    {
+        int x;
+        int y;
+        int width;
+        int height;
+    };
+    
+    struct SweepResult
+    {
+        // How far the box can actually move.
+        int dx;
+        int dy;
+        // Whether something was hit, and the first blocking tile if so.
+        bool hit;
+        int tileX;
+        int tileY;
+    };
+    
+    namespace details
+    {
+        inline int tileOf(int pixel, int tileSize) noexcept
+        {
+            return (pixel >= 0) ? pixel / tileSize : -((-pixel + tileSize - 1) / tileSize);
+        }
+        
+        // Sweeps the leading edge `edge` by `delta` along one axis, over the tiles [crossFirst; crossLast] of the other axis.
+        // Returns how far it can go, and sets hitTile / hitCross if it's stopped.
+        template<class GridT, bool horizontalP>
+        int sweepAxis(GridT& grid, int edge, int delta, int crossFirst, int crossLast, std::uint8_t blockingEvent, int& hitTile, int& hitCross) noexcept
+        {
+            constexpr int tileSize = horizontalP ? PROJ_TILE_W : PROJ_TILE_H;
+            
+            if (delta == 0)
+                return 0;
+            
+            int step = (delta > 0) ? 1 : -1;
+            int lastTile = tileOf(edge + delta, tileSize);
+            
+            for (int tile = tileOf(edge, tileSize) + step; tile != lastTile + step; tile += step)
+                for (int cross = crossFirst; cross <= crossLast; cross++)
+                {
+                    auto event = horizontalP ? grid.eventAt(tile, cross) : grid.eventAt(cross, tile);
+                    
+                    if (event == blockingEvent)
+                    {
+                        hitTile = tile;
+                        hitCross = cross;
+                        // Stops right against the blocking tile.
+                        return (step > 0) ? tile * tileSize - 1 - edge : (tile + 1) * tileSize - edge;
+                    }
+                }
+            return delta;
+        }
+    }
+    
+    // Moves the box by (dx, dy) across any grid providing eventAt(tileX, tileY), resolving X then Y.
+    // Only the tiles entered by the box's leading edges are looked up, so large moves can't tunnel through walls.
+    template<class GridT>
+    SweepResult sweep(GridT& grid, const Box& box, int dx, int dy, std::uint8_t blockingEvent) noexcept
+    {
+        using details::tileOf;
+        
+        SweepResult result{0, 0, false, 0, 0};
+        int hitTile, hitCross;
+        
+        result.dx = details::sweepAxis<GridT, true>(grid, (dx > 0) ? box.x + box.width - 1 : box.x, dx,
+                                                    tileOf(box.y, PROJ_TILE_H), tileOf(box.y + box.height - 1, PROJ_TILE_H),
+                                                    blockingEvent, hitTile, hitCross);
+        if (result.dx != dx)
+        {
+            result.hit = true;
+            result.tileX = hitTile;
+            result.tileY = hitCross;
+        }
+        
+        int x = box.x + result.dx;
+        
+        result.dy = details::sweepAxis<GridT, false>(grid, (dy > 0) ? box.y + box.height - 1 : box.y, dy,
+                                                     tileOf(x, PROJ_TILE_W), tileOf(x + box.width - 1, PROJ_TILE_W),
+                                                     blockingEvent, hitTile, hitCross);
+        if ((result.dy != dy) && !result.hit)
+        {
+            result.hit = true;
+            result.tileX = hitCross;
+            result.tileY = hitTile;
+        }
+        return result;
+    }
+}
+
+
+#endif // WORLD_COLLISION_HPP
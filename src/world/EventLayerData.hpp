@@ -0,0 +1,32 @@
+#ifndef WORLD_EVENTLAYERDATA_HPP
+#   define WORLD_EVENTLAYERDATA_HPP
+
+#   include <cstdint>
+
+
+namespace world
+{
+    // A map's event layer, as emitted by the TMX converter.
+    // Each cell's MapEnum value is packed on `bits` bits (2 or 4), LSB first, with no padding between rows.
+    struct EventLayerData
+    {
+        std::uint16_t width;
+        std::uint16_t height;
+        std::uint8_t bits;
+        const std::uint8_t* cells;
+        
+        // Returns the event at the given tile coordinates, or 0 (EMPTY) if outside of the map.
+        std::uint8_t eventAt(int tileX, int tileY) const noexcept
+        {
+            if ((tileX < 0) || (tileY < 0) || (tileX >= width) || (tileY >= height))
+                return 0;
+            
+            unsigned bit = (tileY * width + tileX) * bits;
+            
+            return (cells[bit >> 3] >> (bit & 7)) & ((1 << bits) - 1);
+        }
+    };
+}
+
+
+#endif // WORLD_EVENTLAYERDATA_HPP
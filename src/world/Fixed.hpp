@@ -0,0 +1,29 @@
+#ifndef WORLD_FIXED_HPP
+#   define WORLD_FIXED_HPP
+
+#   include <cstdint>
+
+
+namespace world
+{
+    // An 8.8 fixed point value: pixels on the high bits, 1/256th of pixels on the low 8 bits.
+    // Stored on 32 bits so that map coordinates don't overflow.
+    using Fixed = std::int32_t;
+    
+    constexpr int fixedShift = 8;
+    constexpr Fixed fixedOne = 1 << fixedShift;
+    
+    constexpr Fixed toFixed(int pixels) noexcept
+    {
+        return pixels * fixedOne;
+    }
+    
+    // Rounds towards minus infinity, so that sub-pixels don't shift a pixel around 0.
+    constexpr int toPixels(Fixed value) noexcept
+    {
+        return value >> fixedShift;
+    }
+}
+
+
+#endif // WORLD_FIXED_HPP
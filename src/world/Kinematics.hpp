@@ -0,0 +1,86 @@
+#ifndef WORLD_KINEMATICS_HPP
+#   define WORLD_KINEMATICS_HPP
+
+#   include "world/Collision.hpp"
+#   include "world/Fixed.hpp"
+
+
+namespace world
+{
+    // How a body speeds up and slows down, per frame, in fixed point.
+    struct Motion
+    {
+        Fixed acceleration;
+        // Speed lost per frame while not accelerating.
+        Fixed friction;
+        Fixed maxSpeed;
+    };
+    
+    // A moving box, positioned by its center with sub-pixel precision.
+    struct Body
+    {
+        Fixed x;
+        Fixed y;
+        Fixed velocityX;
+        Fixed velocityY;
+        int halfWidth;
+        int halfHeight;
+        
+        int pixelX() const noexcept { return toPixels(x); }
+        int pixelY() const noexcept { return toPixels(y); }
+        
+        // The collision box at the current pixel position.
+        Box box() const noexcept
+        {
+            return {pixelX() - halfWidth, pixelY() - halfHeight, halfWidth * 2, halfHeight * 2};
+        }
+    };
+    
+    namespace details
+    {
+        inline Fixed accelerate(Fixed velocity, int direction, const Motion& motion) noexcept
+        {
+            if (direction != 0)
+            {
+                velocity += direction * motion.acceleration;
+                return (velocity > motion.maxSpeed) ? motion.maxSpeed : (velocity < -motion.maxSpeed) ? -motion.maxSpeed : velocity;
+            }
+            if (velocity > 0)
+                return (velocity > motion.friction) ? velocity - motion.friction : 0;
+            return (velocity < -motion.friction) ? velocity + motion.friction : 0;
+        }
+        
+        // Moves one axis by the pixels `moved` out of the `wanted` ones, stopping it against what blocked it.
+        inline void advance(Fixed& position, Fixed& velocity, int moved, int wanted) noexcept
+        {
+            if (moved == wanted)
+                position += velocity;
+            else
+            {
+                position = toFixed(toPixels(position) + moved);
+                velocity = 0;
+            }
+        }
+    }
+    
+    // Steers the body towards (directionX, directionY), each in [-1; 1], then moves it by its velocity across the grid.
+    // Collisions are resolved once per frame, with a single sweep over the pixels the body enters, X then Y.
+    // Returns the sweep's result, in pixels.
+    template<class GridT>
+    SweepResult move(GridT& grid, Body& body, int directionX, int directionY, const Motion& motion, std::uint8_t blockingEvent) noexcept
+    {
+        body.velocityX = details::accelerate(body.velocityX, directionX, motion);
+        body.velocityY = details::accelerate(body.velocityY, directionY, motion);
+        
+        int dx = toPixels(body.x + body.velocityX) - body.pixelX();
+        int dy = toPixels(body.y + body.velocityY) - body.pixelY();
+        auto result = sweep(grid, body.box(), dx, dy, blockingEvent);
+        
+        details::advance(body.x, body.velocityX, result.dx, dx);
+        details::advance(body.y, body.velocityY, result.dy, dy);
+        return result;
+    }
+}
+
+
+#endif // WORLD_KINEMATICS_HPP
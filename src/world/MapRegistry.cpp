@@ -0,0 +1,71 @@
+#include "world/MapRegistry.hpp"
+
+#include <cstring>
+
+#include "maps.h"
+
+
+namespace world
+{
+    MapRegistry mapRegistry;
+    
+    std::uint32_t MapHandle::id() const noexcept
+    {
+        return _entry - mapTable;
+    }
+    
+    MapHandle MapRegistry::find(const char* name) noexcept
+    {
+        for (std::uint32_t id = 0; id < mapCount; id++)
+            if (std::strcmp(mapTable[id].name, name) == 0)
+                return MapHandle(&mapTable[id]);
+        return MapHandle();
+    }
+    
+    MapHandle MapRegistry::find(std::uint32_t id) noexcept
+    {
+        return (id < mapCount) ? MapHandle(&mapTable[id]) : MapHandle();
+    }
+    
+    void MapRegistry::enter(MapHandle map, Tilemap& tilemap, int focusX, int focusY) noexcept
+    {
+        if (&tilemap != _tilemap)
+            std::memset(_registeredTiles, 0, sizeof(_registeredTiles));
+        _current = map;
+        _tilemap = &tilemap;
+        _focusX = focusX;
+        _focusY = focusY;
+        _used = false;
+    }
+    
+    void MapRegistry::release() noexcept
+    {
+        _current = MapHandle();
+        _tilemap = nullptr;
+        _used = false;
+        std::memset(_registeredTiles, 0, sizeof(_registeredTiles));
+        chunkStreamer.clear();
+    }
+    
+    ChunkStreamer& MapRegistry::streamer() noexcept
+    {
+        if (!_used && _current.valid())
+        {
+            const auto& entry = _current.entry();
+            
+            for (unsigned i = 0; i < entry.tileIdCount; i++)
+            {
+                auto id = entry.tileIds[i];
+                
+                if (_registeredTiles[id / 32] & (1u << (id % 32)))
+                    continue;
+                _tilemap->setTile(id, POK_TILE_W, POK_TILE_H, tiles + id * POK_TILE_W * POK_TILE_H);
+                _registeredTiles[id / 32] |= 1u << (id % 32);
+            }
+            chunkStreamer.setMap(_current.chunked(), _focusX, _focusY);
+            chunkStreamer.bind(*_tilemap);
+            _used = true;
+        }
+        return chunkStreamer;
+    }
+}
@@ -0,0 +1,70 @@
+#ifndef WORLD_MAPREGISTRY_HPP
+#   define WORLD_MAPREGISTRY_HPP
+
+#   include "Pokitto.h"
+#   include <Tilemap.hpp>
+
+#   include "world/ChunkStreamer.hpp"
+#   include "world/MapTable.hpp"
+
+
+namespace world
+{
+    // A map of the build's map table. Invalid when the map isn't in the build.
+    class MapHandle
+    {
+    public:
+        MapHandle() noexcept = default;
+        explicit MapHandle(const MapTableEntry* entry) noexcept : _entry(entry) {}
+        
+        bool valid() const noexcept { return _entry != nullptr; }
+        bool operator==(const MapHandle& other) const noexcept { return _entry == other._entry; }
+        bool operator!=(const MapHandle& other) const noexcept { return _entry != other._entry; }
+        
+        // The map's index in the map table. Ids depend on which maps are excluded from the build, names don't.
+        std::uint32_t id() const noexcept;
+        const char* name() const noexcept { return _entry->name; }
+        const ChunkedMapData& chunked() const noexcept { return *_entry->chunked; }
+        const EventLayerData& events() const noexcept { return *_entry->events; }
+        const TriggerIndexData& triggers() const noexcept { return *_entry->triggers; }
+        const MapTableEntry& entry() const noexcept { return *_entry; }
+        
+    private:
+        const MapTableEntry* _entry = nullptr;
+    };
+    
+    // Looks maps up, and holds the current scene's map.
+    // Entering a map costs nothing: its tiles are registered with the scene's Tilemap and its window decoded on first use.
+    class MapRegistry
+    {
+    public:
+        static MapHandle find(const char* name) noexcept;
+        static MapHandle find(std::uint32_t id) noexcept;
+        
+        // Makes the map the current one, around the focus point (in pixels), drawn by the given Tilemap.
+        // Tiles already registered with that Tilemap by a previous map of the scene aren't registered again.
+        void enter(MapHandle map, Tilemap& tilemap, int focusX, int focusY) noexcept;
+        
+        // Forgets the current map and the Tilemap's registered tiles. Call when the scene ends.
+        void release() noexcept;
+        
+        MapHandle current() const noexcept { return _current; }
+        
+        // The current map's streaming window. The first call after enter() registers the tiles and decodes the window.
+        ChunkStreamer& streamer() noexcept;
+        
+    private:
+        MapHandle _current;
+        Tilemap* _tilemap = nullptr;
+        int _focusX = 0;
+        int _focusY = 0;
+        bool _used = false;
+        // One bit per tile id registered with _tilemap.
+        std::uint32_t _registeredTiles[256 / 32] = {};
+    };
+    
+    extern MapRegistry mapRegistry;
+}
+
+
+#endif // WORLD_MAPREGISTRY_HPP
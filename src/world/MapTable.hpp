@@ -0,0 +1,29 @@
+#ifndef WORLD_MAPTABLE_HPP
+#   define WORLD_MAPTABLE_HPP
+
+#   include <cstdint>
+
+#   include "world/ChunkedMapData.hpp"
+#   include "world/EventLayerData.hpp"
+#   include "world/TriggerIndexData.hpp"
+
+
+namespace world
+{
+    // A map of the generated map table (mapTable, in maps.h).
+    struct MapTableEntry
+    {
+        const char* name;
+        // Width, height, then a tile id per cell.
+        const std::uint8_t* cells;
+        // The sorted ids of the tiles the map uses.
+        const std::uint8_t* tileIds;
+        std::uint16_t tileIdCount;
+        const ChunkedMapData* chunked;
+        const EventLayerData* events;
+        const TriggerIndexData* triggers;
+    };
+}
+
+
+#endif // WORLD_MAPTABLE_HPP
@@ -0,0 +1,31 @@
+#ifndef WORLD_TRIGGERINDEXDATA_HPP
+#   define WORLD_TRIGGERINDEXDATA_HPP
+
+#   include <cstdint>
+
+
+namespace world
+{
+    // A rectangle of contiguous tiles sharing an event, in tiles.
+    struct TriggerRect
+    {
+        std::uint16_t x;
+        std::uint16_t y;
+        std::uint16_t width;
+        std::uint16_t height;
+        std::uint8_t event;
+    };
+    
+    // A map's trigger rectangles, as emitted by the TMX converter.
+    // Rectangles are sorted by y then x, and don't overlap.
+    struct TriggerIndexData
+    {
+        std::uint16_t count;
+        // The tallest rectangle's height, which bounds how far up a lookup has to scan.
+        std::uint16_t maxHeight;
+        const TriggerRect* rects;
+    };
+}
+
+
+#endif // WORLD_TRIGGERINDEXDATA_HPP
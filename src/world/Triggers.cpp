@@ -0,0 +1,100 @@
+#include "world/Triggers.hpp"
+
+#include "Pokitto.h"
+
+
+namespace world
+{
+    namespace
+    {
+        // Returns the index of the first rectangle whose top row is >= y.
+        unsigned firstRectFrom(const TriggerIndexData& index, int y) noexcept
+        {
+            unsigned low = 0;
+            unsigned high = index.count;
+            
+            while (low < high)
+            {
+                unsigned middle = (low + high) / 2;
+                
+                if (index.rects[middle].y < y)
+                    low = middle + 1;
+                else
+                    high = middle;
+            }
+            return low;
+        }
+        
+        bool contains(const TriggerRect& rect, int tileX, int tileY) noexcept
+        {
+            return (tileX >= rect.x) && (tileX < rect.x + rect.width) && (tileY >= rect.y) && (tileY < rect.y + rect.height);
+        }
+        
+        // Collects up to `capacity` rectangles containing the tile.
+        unsigned collect(const TriggerIndexData& index, int tileX, int tileY, const TriggerRect** found, unsigned capacity) noexcept
+        {
+            unsigned count = 0;
+            
+            if ((tileX < 0) || (tileY < 0))
+                return 0;
+            // Only rectangles starting at most maxHeight - 1 rows above can reach this row.
+            for (unsigned i = firstRectFrom(index, tileY - index.maxHeight + 1); (i < index.count) && (index.rects[i].y <= tileY); i++)
+                if (contains(index.rects[i], tileX, tileY) && (count < capacity))
+                    found[count++] = &index.rects[i];
+            return count;
+        }
+        
+        bool isIn(const TriggerRect* rect, const TriggerRect* const* rects, unsigned count) noexcept
+        {
+            for (unsigned i = 0; i < count; i++)
+                if (rects[i] == rect)
+                    return true;
+            return false;
+        }
+        
+        int tileOf(int pixel, int tileSize) noexcept
+        {
+            return (pixel >= 0) ? pixel / tileSize : -1;
+        }
+    }
+    
+    bool TriggerChanges::entersEvent(std::uint8_t event) const noexcept
+    {
+        for (unsigned i = 0; i < enteredCount; i++)
+            if (entered[i]->event == event)
+                return true;
+        return false;
+    }
+    
+    const TriggerRect* triggerAt(const TriggerIndexData& index, int x, int y) noexcept
+    {
+        const TriggerRect* found;
+        
+        return collect(index, tileOf(x, PROJ_TILE_W), tileOf(y, PROJ_TILE_H), &found, 1) ? found : nullptr;
+    }
+    
+    TriggerChanges triggersBetween(const TriggerIndexData& index, int fromX, int fromY, int toX, int toY) noexcept
+    {
+        TriggerChanges changes;
+        int fromTileX = tileOf(fromX, PROJ_TILE_W);
+        int fromTileY = tileOf(fromY, PROJ_TILE_H);
+        int toTileX = tileOf(toX, PROJ_TILE_W);
+        int toTileY = tileOf(toY, PROJ_TILE_H);
+        
+        if ((fromTileX == toTileX) && (fromTileY == toTileY))
+            return changes;
+        
+        const TriggerRect* before[TriggerChanges::capacity];
+        const TriggerRect* after[TriggerChanges::capacity];
+        unsigned beforeCount = collect(index, fromTileX, fromTileY, before, TriggerChanges::capacity);
+        unsigned afterCount = collect(index, toTileX, toTileY, after, TriggerChanges::capacity);
+        
+        for (unsigned i = 0; i < afterCount; i++)
+            if (!isIn(after[i], before, beforeCount))
+                changes.entered[changes.enteredCount++] = after[i];
+        for (unsigned i = 0; i < beforeCount; i++)
+            if (!isIn(before[i], after, afterCount))
+                changes.exited[changes.exitedCount++] = before[i];
+        return changes;
+    }
+}
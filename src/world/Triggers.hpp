@@ -0,0 +1,32 @@
+#ifndef WORLD_TRIGGERS_HPP
+#   define WORLD_TRIGGERS_HPP
+
+#   include "world/TriggerIndexData.hpp"
+
+
+namespace world
+{
+    // The triggers entered and exited by a move.
+    struct TriggerChanges
+    {
+        static constexpr unsigned capacity = 4;
+        
+        std::uint8_t enteredCount = 0;
+        std::uint8_t exitedCount = 0;
+        const TriggerRect* entered[capacity];
+        const TriggerRect* exited[capacity];
+        
+        // Whether the given event was entered.
+        bool entersEvent(std::uint8_t event) const noexcept;
+    };
+    
+    // Returns the first trigger containing the given point (in pixels), or nullptr.
+    const TriggerRect* triggerAt(const TriggerIndexData& index, int x, int y) noexcept;
+    
+    // Returns the triggers entered and exited by moving a point from (fromX, fromY) to (toX, toY), in pixels.
+    // Moves staying within the same tile cost nothing.
+    TriggerChanges triggersBetween(const TriggerIndexData& index, int fromX, int fromY, int toX, int toY) noexcept;
+}
+
+
+#endif // WORLD_TRIGGERS_HPP